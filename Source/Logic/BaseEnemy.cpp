@@ -1,23 +1,44 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "BaseEnemy.h"
+#include "EnemyRegistrySubsystem.h"
+#include "EnemyBatchUpdateSubsystem.h"
+#include "EnemyPoolSubsystem.h"
+#include "EnemyPersistenceSubsystem.h"
+#include "EnemyStateMachineSubsystem.h"
+#include "EnemySquadSubsystem.h"
+#include "CombatEventSubsystem.h"
+#include "LogicStats.h"
+#include "LogicMemory.h"
 #include "AIController.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "Perception/PawnSensingComponent.h"
-#include "Components/WidgetComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/Engine.h"
 #include "Engine/DamageEvents.h"
 #include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 ABaseEnemy::ABaseEnemy()
 {
+	LLM_SCOPE_BYTAG(Logic_Enemies);
+
 	PrimaryActorTick.bCanEverTick = true;
 
+	// 풀/스폰 서비스로 생성된 적도 AI Controller를 갖도록
+	AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
+
+	// 복제: 이동은 캐릭터 기본 복제, 상태는 푸시 모델. Idle/Dead에서는 휴면
+	bReplicates = true;
+	NetDormancy = DORM_Awake;
+	SetNetUpdateFrequency(10.0f);
+	SetMinNetUpdateFrequency(2.0f);
+
 	// 기본 컴포넌트 초기화
 	InitializeComponents();
 }
@@ -25,21 +46,276 @@ ABaseEnemy::ABaseEnemy()
 void ABaseEnemy::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// 언로드됐던 셀에서 죽은 배치 적은 초기화 없이 바로 제거
+	FEnemyPersistedState PersistedState;
+	UEnemyPersistenceSubsystem* Persistence = HasAuthority() ? UEnemyPersistenceSubsystem::Get(this) : nullptr;
+	const bool bHasPersistedState = Persistence && Persistence->FindPersistedState(this, PersistedState);
+	if (bHasPersistedState && PersistedState.bIsDead)
+	{
+		bIsDead = true;
+		SetActorHiddenInGame(true);
+		SetActorEnableCollision(false);
+		Destroy();
+		return;
+	}
+
+	// 공용 감지 서비스를 쓰면 개별 감지 타이머는 끔
+	if (bUseSharedPerception && PawnSensingComponent)
+	{
+		PawnSensingComponent->SetSensingUpdatesEnabled(false);
+	}
+	
+	// 아키타입이 없는 적은 에디터에서 지정한 값을 기준 스탯으로 사용
+	InstanceBaseStats.MaxHealth = MaxHealth;
+	InstanceBaseStats.AttackDamage = AttackDamage;
+	InstanceBaseStats.AttackRange = AttackRange;
+	InstanceBaseStats.DetectionRange = DetectionRange;
+	InstanceBaseStats.MovementSpeed = MovementSpeed;
+	InstanceBaseStats.ExperienceReward = ExperienceReward;
+	BaseLevel = Level;
+	BaseRank = EnemyRank;
+	SavedCapsuleCollision = GetCapsuleComponent()->GetCollisionEnabled();
+	SavedMeshCollision = GetMesh()->GetCollisionEnabled();
 	
 	// 초기화 함수들 호출
 	InitializeStats();
 	InitializeAI();
+
+	// 언로드됐던 셀에서 돌아온 배치 적은 저장된 상태를 이어받음
+	if (bHasPersistedState)
+	{
+		ApplyPersistedState(PersistedState);
+	}
 	
 	// 체력바 업데이트
 	UpdateHealthBar();
+
+	// 처음에는 Idle이므로 휴면 (초기 복제 후)
+	UpdateNetDormancy();
+
+	RegisterWithSubsystems();
+}
+
+void ABaseEnemy::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// 셀 언로드/삭제 시 상태 보존 (배치 적만 기록됨)
+	if (UEnemyPersistenceSubsystem* Persistence = HasAuthority() ? UEnemyPersistenceSubsystem::Get(this) : nullptr)
+	{
+		Persistence->CaptureEnemy(this, EndPlayReason);
+	}
+
+	UnregisterFromSubsystems();
+	ClearCombatTimers();
+
+	if (bPooled)
+	{
+		if (UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this))
+		{
+			Pool->ForgetEnemy(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ABaseEnemy::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREP_LIFETIME_WITH_PARAMS_FAST(ABaseEnemy, CurrentHealth, Params);
+	DOREP_LIFETIME_WITH_PARAMS_FAST(ABaseEnemy, CurrentState, Params);
+	DOREP_LIFETIME_WITH_PARAMS_FAST(ABaseEnemy, bIsDead, Params);
+	DOREP_LIFETIME_WITH_PARAMS_FAST(ABaseEnemy, bIsStunned, Params);
+	DOREP_LIFETIME_WITH_PARAMS_FAST(ABaseEnemy, TargetPlayer, Params);
+}
+
+bool ABaseEnemy::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	if (bInPool)
+	{
+		return false;
+	}
+
+	// 쫓고 있는 플레이어는 거리와 상관없이 받아야 함
+	if (TargetPlayer && (TargetPlayer == ViewTarget || TargetPlayer == RealViewer))
+	{
+		return true;
+	}
+
+	FVector CachedLocation;
+	const UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
+	if (Registry && Registry->GetCachedLocation(this, CachedLocation))
+	{
+		return FVector::DistSquared(CachedLocation, SrcLocation) < GetNetCullDistanceSquared();
+	}
+
+	// 죽어서 레지스트리에서 빠진 적은 기본 판정
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
+
+void ABaseEnemy::UpdateNetDormancy()
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	// 휴면 전환 시 마지막 변경은 채널이 닫히기 전에 전송됨
+	const bool bShouldSleep = (CurrentState == EEnemyState::Idle && CanSleepWhileIdle()) || CurrentState == EEnemyState::Dead;
+	SetNetDormancy(bShouldSleep ? DORM_DormantAll : DORM_Awake);
+}
+
+void ABaseEnemy::FlushReplicatedState()
+{
+	if (HasAuthority() && NetDormancy > DORM_Awake)
+	{
+		FlushNetDormancy();
+	}
+}
+
+void ABaseEnemy::OnRep_CurrentHealth()
+{
+	UpdateHealthBar();
+}
+
+void ABaseEnemy::OnRep_CurrentState()
+{
+	NotifyStateChanged(CurrentState);
+}
+
+void ABaseEnemy::OnRep_IsDead()
+{
+	if (bIsDead)
+	{
+		// 서버의 Die와 같은 표시 처리 (AI는 서버에만 있음)
+		UnregisterFromSubsystems();
+		GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		GetMesh()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+		OnEnemyDeath.Broadcast(this);
+		OnDeathEvent();
+	}
+	else
+	{
+		// 풀에서 재사용됨
+		GetCapsuleComponent()->SetCollisionEnabled(SavedCapsuleCollision);
+		GetMesh()->SetCollisionEnabled(SavedMeshCollision);
+		RegisterWithSubsystems();
+		UpdateHealthBar();
+	}
+}
+
+void ABaseEnemy::RegisterWithSubsystems()
+{
+	// 적 레지스트리에 등록 (락온/범위 검색용)
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterEnemy(this);
+	}
+
+	// AI 구동은 서버에서만
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	// 네이티브 상태 머신이 거리 기반 전환까지 처리하므로 일괄 업데이트는 필요 없음
+	if (UsesNativeStateMachine())
+	{
+		if (UEnemyStateMachineSubsystem* StateMachine = UEnemyStateMachineSubsystem::Get(this))
+		{
+			StateMachine->RegisterEnemy(this);
+		}
+
+		// 분대가 타겟/공격 순서를 정하고 상태 머신은 지시대로 이동/공격만 함
+		if (bJoinSquad)
+		{
+			if (UEnemySquadSubsystem* Squads = UEnemySquadSubsystem::Get(this))
+			{
+				Squads->RegisterEnemy(this);
+			}
+		}
+	}
+	// 일괄 업데이트 사용 시 매니저가 Tick을 대신함
+	else if (bUseBatchedUpdate)
+	{
+		if (UEnemyBatchUpdateSubsystem* BatchUpdate = UEnemyBatchUpdateSubsystem::Get(this))
+		{
+			BatchUpdate->RegisterEnemy(this);
+		}
+	}
+}
+
+void ABaseEnemy::UnregisterFromSubsystems()
+{
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterEnemy(this);
+	}
+
+	if (UEnemyBatchUpdateSubsystem* BatchUpdate = UEnemyBatchUpdateSubsystem::Get(this))
+	{
+		BatchUpdate->UnregisterEnemy(this, false);
+	}
+
+	if (UEnemyStateMachineSubsystem* StateMachine = UEnemyStateMachineSubsystem::Get(this))
+	{
+		StateMachine->UnregisterEnemy(this, false);
+	}
+
+	if (UEnemySquadSubsystem* Squads = UEnemySquadSubsystem::Get(this))
+	{
+		Squads->UnregisterEnemy(this);
+	}
+}
+
+void ABaseEnemy::PauseAI(const FString& Reason)
+{
+	bAIPaused = true;
+
+	if (EnemyAIController && EnemyAIController->BrainComponent)
+	{
+		EnemyAIController->BrainComponent->PauseLogic(Reason);
+	}
+}
+
+void ABaseEnemy::ResumeAI(const FString& Reason)
+{
+	bAIPaused = false;
+
+	if (EnemyAIController && EnemyAIController->BrainComponent && EnemyAIController->BrainComponent->IsPaused())
+	{
+		EnemyAIController->BrainComponent->ResumeLogic(Reason);
+	}
+}
+
+void ABaseEnemy::StopAI(const FString& Reason)
+{
+	bAIPaused = true;
+
+	if (EnemyAIController)
+	{
+		EnemyAIController->StopMovement();
+		if (EnemyAIController->BrainComponent)
+		{
+			EnemyAIController->BrainComponent->StopLogic(Reason);
+		}
+	}
 }
 
 void ABaseEnemy::Tick(float DeltaTime)
 {
+	LOGIC_COMBAT_SCOPE(STAT_LogicEnemyTick);
+	INC_DWORD_STAT(STAT_LogicNumEnemyTicks);
+
 	Super::Tick(DeltaTime);
 
-	// 타겟이 있을 때 거리 체크 및 상태 업데이트
-	if (TargetPlayer && IsAlive())
+	// 타겟이 있을 때 거리 체크 및 상태 업데이트 (서버만)
+	if (TargetPlayer && IsAlive() && HasAuthority())
 	{
 		float DistanceToTarget = GetDistanceToTarget();
 		
@@ -70,12 +346,6 @@ void ABaseEnemy::InitializeComponents()
 	PawnSensingComponent->SightRadius = DetectionRange;
 	PawnSensingComponent->OnSeePawn.AddDynamic(this, &ABaseEnemy::OnPawnSeen);
 
-	// 체력바 위젯 컴포넌트
-	HealthBarWidget = CreateDefaultSubobject<UWidgetComponent>(TEXT("HealthBarWidget"));
-	HealthBarWidget->SetupAttachment(RootComponent);
-	HealthBarWidget->SetRelativeLocation(FVector(0.0f, 0.0f, 100.0f));
-	HealthBarWidget->SetWidgetSpace(EWidgetSpace::Screen);
-
 	// 캐릭터 설정
 	GetCapsuleComponent()->SetCollisionResponseToChannel(ECollisionChannel::ECC_Camera, ECollisionResponse::ECR_Ignore);
 	
@@ -85,41 +355,37 @@ void ABaseEnemy::InitializeComponents()
 
 void ABaseEnemy::InitializeStats()
 {
-	CurrentHealth = MaxHealth;
-	
-	// 레벨에 따른 스탯 조정
-	if (Level > 1)
+	if (Archetype)
 	{
-		float LevelMultiplier = 1.0f + (Level - 1) * 0.15f; // 레벨당 15% 증가
-		MaxHealth *= LevelMultiplier;
-		CurrentHealth = MaxHealth;
-		AttackDamage *= LevelMultiplier;
-		ExperienceReward = 50 + (Level - 1) * 10;
+		// 공유 테이블에서 바로 복사 (인스턴스별 계산 없음). 블록은 아키타입 + 레벨/등급으로만 참조
+		StatBlockLevel = Level;
+		StatBlockRank = EnemyRank;
+		ApplyStatBlock(Archetype->GetStatBlock(StatBlockLevel, StatBlockRank));
 	}
+	else
+	{
+		ApplyStatBlock(UEnemyArchetype::ComputeStatBlock(InstanceBaseStats, Level, EnemyRank));
+	}
+}
+
+const FEnemyStatBlock* ABaseEnemy::GetStatBlock() const
+{
+	return Archetype ? &Archetype->GetStatBlock(StatBlockLevel, StatBlockRank) : nullptr;
+}
 
-	// 적 등급에 따른 스탯 조정
-	switch (EnemyRank)
+void ABaseEnemy::ApplyStatBlock(const FEnemyStatBlock& Stats)
+{
+	MaxHealth = Stats.MaxHealth;
+	CurrentHealth = MaxHealth;
+	AttackDamage = Stats.AttackDamage;
+	AttackRange = Stats.AttackRange;
+	DetectionRange = Stats.DetectionRange;
+	MovementSpeed = Stats.MovementSpeed;
+	ExperienceReward = Stats.ExperienceReward;
+
+	if (PawnSensingComponent)
 	{
-	case EEnemyRank::Elite:
-		MaxHealth *= 2.0f;
-		CurrentHealth = MaxHealth;
-		AttackDamage *= 1.5f;
-		ExperienceReward *= 2;
-		break;
-	case EEnemyRank::MiniBoss:
-		MaxHealth *= 3.0f;
-		CurrentHealth = MaxHealth;
-		AttackDamage *= 2.0f;
-		ExperienceReward *= 3;
-		break;
-	case EEnemyRank::Boss:
-		MaxHealth *= 5.0f;
-		CurrentHealth = MaxHealth;
-		AttackDamage *= 3.0f;
-		ExperienceReward *= 5;
-		break;
-	default:
-		break;
+		PawnSensingComponent->SightRadius = DetectionRange;
 	}
 
 	// 이동 속도 설정
@@ -138,8 +404,8 @@ void ABaseEnemy::InitializeAI()
 	{
 		BlackboardComponent = EnemyAIController->GetBlackboardComponent();
 		
-		// Behavior Tree 실행
-		if (BehaviorTree)
+		// Behavior Tree 실행 (네이티브 상태 머신을 쓰면 RegisterWithSubsystems에서 등록)
+		if (BehaviorTree && !UsesNativeStateMachine())
 		{
 			EnemyAIController->RunBehaviorTree(BehaviorTree);
 		}
@@ -160,24 +426,44 @@ float ABaseEnemy::TakeDamage(float DamageAmount, const struct FDamageEvent& Dama
 
 void ABaseEnemy::ApplyDamage(float DamageAmount, AActor* DamageDealer)
 {
-	if (bIsDead) return;
+	INC_DWORD_STAT(STAT_LogicNumDamageEvents);
 
-	CurrentHealth = FMath::Clamp(CurrentHealth - DamageAmount, 0.0f, MaxHealth);
-	
-	// 델리게이트 호출
-	OnEnemyTakeDamage.Broadcast(this, DamageAmount);
-	
-	// 블루프린트 이벤트 호출
-	OnTakeDamageEvent(DamageAmount);
-	
-	// 체력바 업데이트
-	UpdateHealthBar();
+	// 데미지 판정은 서버에서만
+	if (bIsDead || bInPool || !HasAuthority()) return;
+
+	// 같은 프레임의 다른 타격과 합쳐서 적용
+	if (UCombatEventSubsystem* CombatEvents = UCombatEventSubsystem::Get(this))
+	{
+		CombatEvents->QueueDamage(this, DamageAmount, DamageDealer);
+		return;
+	}
+
+	if (ApplyCoalescedDamage(DamageAmount, DamageDealer))
+	{
+		NotifyDamageTaken(DamageAmount);
+	}
+}
+
+bool ABaseEnemy::ApplyCoalescedDamage(float TotalDamage, AActor* DamageDealer)
+{
+	LOGIC_COMBAT_SCOPE(STAT_LogicApplyDamage);
+
+	// 풀에 들어간 적은 숨겨진 상태이므로 맞지 않음
+	if (bIsDead || bInPool) return false;
+
+	CurrentHealth = FMath::Clamp(CurrentHealth - TotalDamage, 0.0f, MaxHealth);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ABaseEnemy, CurrentHealth, this);
+	FlushReplicatedState();
 	
 	// 데미지 딜러를 타겟으로 설정 (플레이어인 경우)
 	if (DamageDealer && DamageDealer->IsA<APawn>())
 	{
 		SetTarget(Cast<APawn>(DamageDealer));
-		StartChasing();
+		// 상태 머신 적은 다음 예산 평가에서 HasTarget 전환으로 추적을 시작함 (광역 피격 시 몰림 방지)
+		if (!UsesNativeStateMachine())
+		{
+			StartChasing();
+		}
 	}
 	
 	// 체력이 0 이하면 죽음
@@ -185,6 +471,38 @@ void ABaseEnemy::ApplyDamage(float DamageAmount, AActor* DamageDealer)
 	{
 		Die();
 	}
+
+	return true;
+}
+
+void ABaseEnemy::NotifyDamageTaken(float TotalDamage)
+{
+	// 델리게이트 호출
+	OnEnemyTakeDamage.Broadcast(this, TotalDamage);
+	
+	// 블루프린트 이벤트 호출
+	OnTakeDamageEvent(TotalDamage);
+	
+	// 체력바 업데이트
+	UpdateHealthBar();
+}
+
+void ABaseEnemy::NotifyStateChanged(EEnemyState NewState)
+{
+	// 델리게이트 호출
+	OnEnemyStateChanged.Broadcast(NewState);
+	
+	// 블루프린트 이벤트 호출
+	OnStateChangedEvent(NewState);
+}
+
+void ABaseEnemy::NotifyDeath()
+{
+	// 델리게이트 호출
+	OnEnemyDeath.Broadcast(this);
+	
+	// 블루프린트 이벤트 호출
+	OnDeathEvent();
 }
 
 void ABaseEnemy::Die()
@@ -194,28 +512,238 @@ void ABaseEnemy::Die()
 	bIsDead = true;
 	SetEnemyState(EEnemyState::Dead);
 
+	// 죽은 적은 검색 대상에서 제외
+	UnregisterFromSubsystems();
+
 	// AI 중지
-	if (EnemyAIController)
-	{
-		EnemyAIController->BrainComponent->StopLogic("Dead");
-	}
+	StopAI(TEXT("Dead"));
 
 	// 충돌 비활성화
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	GetMesh()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
-	// 델리게이트 호출
-	OnEnemyDeath.Broadcast(this);
-	
-	// 블루프린트 이벤트 호출
-	OnDeathEvent();
+	// 사망 알림도 피격/상태 변경 알림 뒤에 오도록 프레임 끝에 모아서
+	if (UCombatEventSubsystem* CombatEvents = UCombatEventSubsystem::Get(this))
+	{
+		CombatEvents->QueueDeath(this);
+	}
+	else
+	{
+		NotifyDeath();
+	}
+
+	// 일정 시간 후 풀에 반납 (풀 소속이 아니면 액터 삭제)
+	SetCombatTimer(DespawnTimerHandle, ECombatTimerEvent::Despawn, 5.0f);
+}
 
-	// 일정 시간 후 액터 삭제 (선택사항)
-	FTimerHandle DestroyTimerHandle;
-	GetWorldTimerManager().SetTimer(DestroyTimerHandle, [this]()
+void ABaseEnemy::Despawn()
+{
+	UEnemyPoolSubsystem* Pool = bPooled ? UEnemyPoolSubsystem::Get(this) : nullptr;
+	if (Pool)
+	{
+		Pool->ReleaseEnemy(this);
+	}
+	else
 	{
 		Destroy();
-	}, 5.0f, false);
+	}
+}
+
+void ABaseEnemy::SetCombatTimer(FCombatTimerHandle& Handle, ECombatTimerEvent Event, float Delay)
+{
+	if (UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this))
+	{
+		Timers->SetTimer(Handle, this, Event, Delay);
+		return;
+	}
+
+	// 타이머 서브시스템을 지원하지 않는 월드에서도 쿨다운/디스폰이 멈추지 않도록 엔진 타이머로 대신
+	UWorld* World = GetWorld();
+	if (ensureMsgf(World, TEXT("%s: no world to run combat timer %d"), *GetName(), (int32)Event))
+	{
+		World->GetTimerManager().SetTimer(Handle.FallbackTimer,
+			FTimerDelegate::CreateUObject(this, &ABaseEnemy::OnCombatTimer, Event), FMath::Max(Delay, KINDA_SMALL_NUMBER), false);
+	}
+}
+
+void ABaseEnemy::ClearCombatTimer(FCombatTimerHandle& Handle)
+{
+	if (UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this))
+	{
+		Timers->ClearTimer(Handle);
+	}
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(Handle.FallbackTimer);
+	}
+	Handle.Invalidate();
+}
+
+bool ABaseEnemy::IsCombatTimerActive(const FCombatTimerHandle& Handle) const
+{
+	if (const UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this))
+	{
+		return Timers->IsTimerActive(Handle);
+	}
+
+	const UWorld* World = GetWorld();
+	return World && World->GetTimerManager().IsTimerActive(Handle.FallbackTimer);
+}
+
+void ABaseEnemy::ClearCombatTimers()
+{
+	ClearCombatTimer(StunTimerHandle);
+	ClearCombatTimer(AttackCooldownHandle);
+	ClearCombatTimer(DespawnTimerHandle);
+	ClearCombatTimer(LoseTargetTimerHandle);
+}
+
+void ABaseEnemy::OnCombatTimer(ECombatTimerEvent Event)
+{
+	switch (Event)
+	{
+	case ECombatTimerEvent::StunEnd:
+		OnStunEnd();
+		break;
+	case ECombatTimerEvent::AttackCooldownEnd:
+		OnAttackCooldownEnd();
+		break;
+	case ECombatTimerEvent::LoseTarget:
+		StopChasing();
+		break;
+	case ECombatTimerEvent::Despawn:
+		Despawn();
+		break;
+	default:
+		break;
+	}
+}
+
+void ABaseEnemy::DeactivateForPool()
+{
+	bInPool = true;
+
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	ClearCombatTimers();
+	UnregisterFromSubsystems();
+
+	// 같은 프레임에 들어온 데미지가 재사용된 적에게 적용되지 않도록 버림
+	if (UCombatEventSubsystem* CombatEvents = UCombatEventSubsystem::Get(this))
+	{
+		CombatEvents->CancelPendingDamage(this);
+	}
+
+	// AI와 이동 정지
+	StopAI(TEXT("Pooled"));
+
+	// 죽은 적은 휴면 중이므로 숨김/충돌 변경을 클라이언트에 한 번 보냄
+	FlushReplicatedState();
+
+	if (GetCharacterMovement())
+	{
+		GetCharacterMovement()->StopMovementImmediately();
+		GetCharacterMovement()->SetComponentTickEnabled(false);
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+}
+
+void ABaseEnemy::ResetForReuse()
+{
+	bInPool = false;
+
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	ClearCombatTimers();
+
+	// 상태 초기화
+	bIsDead = false;
+	bIsStunned = false;
+	bCanAttack = true;
+	bAIPaused = false;
+	TargetPlayer = nullptr;
+
+	// 이전 사용에서 RestoreFromCrowd/ApplyPersistedState가 바꾼 레벨/등급을 되돌림
+	Level = BaseLevel;
+	EnemyRank = BaseRank;
+
+	// 기준 스탯에서 다시 적용 (레벨/등급 배율이 중복 적용되지 않음)
+	InitializeStats();
+
+	// 풀에 있는 동안 휴면이었으므로 표시/위치 변경 전에 깨움
+	FlushReplicatedState();
+
+	// 표시/충돌/이동 복구
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	GetCapsuleComponent()->SetCollisionEnabled(SavedCapsuleCollision);
+	GetMesh()->SetCollisionEnabled(SavedMeshCollision);
+	SetActorTickEnabled(true);
+	if (GetCharacterMovement())
+	{
+		GetCharacterMovement()->SetComponentTickEnabled(true);
+		GetCharacterMovement()->SetDefaultMovementMode();
+	}
+
+	// Behavior Tree 재시작
+	InitializeAI();
+	if (BlackboardComponent)
+	{
+		BlackboardComponent->ClearValue("TargetPlayer");
+	}
+	SetEnemyState(EEnemyState::Idle);
+
+	// 풀에서 나온 적은 휴면 상태라도 부활/위치 변경을 한 번 보냄
+	MARK_PROPERTY_DIRTY_FROM_NAME(ABaseEnemy, CurrentHealth, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ABaseEnemy, TargetPlayer, this);
+	FlushReplicatedState();
+
+	RegisterWithSubsystems();
+	UpdateHealthBar();
+}
+
+void ABaseEnemy::RestoreFromCrowd(int32 InLevel, EEnemyRank InRank, EEnemyState InState, float InHealth)
+{
+	const bool bUsedNativeStateMachine = UsesNativeStateMachine();
+
+	Level = InLevel;
+	EnemyRank = InRank;
+	InitializeStats();
+
+	// 등급이 바뀌어 AI 실행 방식(상태 머신/Behavior Tree)이 달라지면 다시 등록
+	if (bUsedNativeStateMachine != UsesNativeStateMachine())
+	{
+		UnregisterFromSubsystems();
+		SetActorTickEnabled(true);
+		InitializeAI();
+		RegisterWithSubsystems();
+	}
+
+	CurrentHealth = FMath::Clamp(InHealth, 1.0f, MaxHealth);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ABaseEnemy, CurrentHealth, this);
+	FlushReplicatedState();
+	SetEnemyState(InState);
+	UpdateHealthBar();
+}
+
+void ABaseEnemy::ApplyPersistedState(const FEnemyPersistedState& State)
+{
+	// 런타임 스폰 적은 레벨/등급 스탯부터 복원
+	if (!State.EnemyClass.IsNull())
+	{
+		RestoreFromCrowd(State.Level, State.Rank, EEnemyState::Idle, MaxHealth);
+	}
+
+	SetActorLocationAndRotation(State.Location, FRotator(0.0f, State.Yaw, 0.0f), false, nullptr, ETeleportType::TeleportPhysics);
+
+	CurrentHealth = FMath::Clamp(State.HealthFraction * MaxHealth, 1.0f, MaxHealth);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ABaseEnemy, CurrentHealth, this);
+
+	// 타겟은 보존하지 않으므로 전투 중이던 적은 평상시 상태로 돌아옴
+	SetEnemyState(State.State == EEnemyState::Patrolling ? EEnemyState::Patrolling : EEnemyState::Idle);
+	FlushReplicatedState();
+	UpdateHealthBar();
 }
 
 void ABaseEnemy::Attack()
@@ -224,7 +752,7 @@ void ABaseEnemy::Attack()
 
 	// 공격 쿨다운 시작
 	bCanAttack = false;
-	GetWorldTimerManager().SetTimer(AttackCooldownHandle, this, &ABaseEnemy::OnAttackCooldownEnd, AttackCooldown, false);
+	SetCombatTimer(AttackCooldownHandle, ECombatTimerEvent::AttackCooldownEnd, AttackCooldown);
 
 	// 블루프린트 이벤트 호출
 	OnAttackEvent();
@@ -241,20 +769,42 @@ void ABaseEnemy::SetEnemyState(EEnemyState NewState)
 {
 	if (CurrentState == NewState) return;
 
+	LOGIC_COMBAT_SCOPE(STAT_LogicStateChange);
+	INC_DWORD_STAT(STAT_LogicNumStateChanges);
+
 	EEnemyState OldState = CurrentState;
 	CurrentState = NewState;
 
-	// 델리게이트 호출
-	OnEnemyStateChanged.Broadcast(NewState);
-	
-	// 블루프린트 이벤트 호출
-	OnStateChangedEvent(NewState);
+	// 스턴/사망 플래그는 항상 상태 전환과 함께 바뀜
+	MARK_PROPERTY_DIRTY_FROM_NAME(ABaseEnemy, CurrentState, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ABaseEnemy, bIsStunned, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ABaseEnemy, bIsDead, this);
+	UpdateNetDormancy();
 
-	// 블랙보드 업데이트
+	// 데미지/스턴/재사용처럼 상태 머신 밖에서 바뀐 상태도 상태 유지 시간을 새로 셈
+	if (UsesNativeStateMachine())
+	{
+		if (UEnemyStateMachineSubsystem* StateMachine = UEnemyStateMachineSubsystem::Get(this))
+		{
+			StateMachine->NotifyStateChanged(this);
+		}
+	}
+
+	// 블랙보드는 Behavior Tree가 바로 읽으므로 즉시 업데이트
 	if (BlackboardComponent)
 	{
 		BlackboardComponent->SetValueAsEnum("EnemyState", (uint8)NewState);
 	}
+
+	// 델리게이트/블루프린트 알림은 프레임 끝에 모아서
+	if (UCombatEventSubsystem* CombatEvents = UCombatEventSubsystem::Get(this))
+	{
+		CombatEvents->QueueStateChange(this, OldState, NewState);
+	}
+	else
+	{
+		NotifyStateChanged(NewState);
+	}
 }
 
 void ABaseEnemy::StunEnemy(float Duration)
@@ -267,18 +817,20 @@ void ABaseEnemy::StunEnemy(float Duration)
 	SetEnemyState(EEnemyState::Stunned);
 
 	// AI 일시 정지
-	if (EnemyAIController)
-	{
-		EnemyAIController->BrainComponent->PauseLogic("Stunned");
-	}
+	PauseAI(TEXT("Stunned"));
 
 	// 스턴 타이머 설정
-	GetWorldTimerManager().SetTimer(StunTimerHandle, this, &ABaseEnemy::OnStunEnd, ActualDuration, false);
+	SetCombatTimer(StunTimerHandle, ECombatTimerEvent::StunEnd, ActualDuration);
 }
 
 void ABaseEnemy::SetTarget(APawn* NewTarget)
 {
-	TargetPlayer = NewTarget;
+	if (TargetPlayer != NewTarget)
+	{
+		TargetPlayer = NewTarget;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ABaseEnemy, TargetPlayer, this);
+		FlushReplicatedState();
+	}
 
 	// 블랙보드 업데이트
 	if (BlackboardComponent && TargetPlayer)
@@ -300,10 +852,7 @@ void ABaseEnemy::StartChasing()
 	SetEnemyState(EEnemyState::Chasing);
 
 	// AI 재시작
-	if (EnemyAIController && EnemyAIController->BrainComponent->IsPaused())
-	{
-		EnemyAIController->BrainComponent->ResumeLogic("StartChasing");
-	}
+	ResumeAI(TEXT("StartChasing"));
 }
 
 void ABaseEnemy::StopChasing()
@@ -312,6 +861,31 @@ void ABaseEnemy::StopChasing()
 	SetEnemyState(EEnemyState::Idle);
 }
 
+void ABaseEnemy::ApplyLODBucket(EEnemyLODBucket NewBucket, const FEnemyLODBucketSettings& Settings)
+{
+	LODBucket = NewBucket;
+
+	SetActorTickInterval(Settings.ActorTickInterval);
+
+	if (GetCharacterMovement())
+	{
+		GetCharacterMovement()->SetComponentTickInterval(Settings.MovementTickInterval);
+	}
+
+	if (GetMesh())
+	{
+		GetMesh()->SetComponentTickInterval(Settings.AnimationTickInterval);
+	}
+
+	if (PawnSensingComponent && !bUseSharedPerception)
+	{
+		PawnSensingComponent->SetSensingInterval(Settings.SensingInterval);
+		PawnSensingComponent->SetSensingUpdatesEnabled(Settings.bEnableSensing);
+	}
+
+	bShowHealthBar = Settings.bShowHealthBar;
+}
+
 float ABaseEnemy::GetDistanceToTarget() const
 {
 	if (!TargetPlayer) return FLT_MAX;
@@ -319,13 +893,34 @@ float ABaseEnemy::GetDistanceToTarget() const
 	return FVector::Dist(GetActorLocation(), TargetPlayer->GetActorLocation());
 }
 
+void ABaseEnemy::HandleSharedPerception(APawn* Pawn, bool bSeen)
+{
+	if (bSeen)
+	{
+		OnPawnSeen(Pawn);
+	}
+	else
+	{
+		OnPawnLost(Pawn);
+	}
+}
+
 void ABaseEnemy::OnPawnSeen(APawn* SeenPawn)
 {
+	LOGIC_COMBAT_SCOPE(STAT_LogicEnemySensing);
+	INC_DWORD_STAT(STAT_LogicNumSensingEvents);
+
+	// 감지/타겟 결정은 서버에서만
+	if (!HasAuthority()) return;
+
 	// 플레이어인지 확인 (태그 또는 클래스로 판단)
 	if (SeenPawn && SeenPawn->ActorHasTag("Player"))
 	{
+		// 다시 보였으면 대기 중인 타겟 상실 처리 취소
+		ClearCombatTimer(LoseTargetTimerHandle);
+
 		SetTarget(SeenPawn);
-		if (TargetPlayer) // TargetPlayer가 유효한지 확인
+		if (TargetPlayer && !UsesNativeStateMachine()) // 상태 머신 적은 스케줄러가 전환
 		{
 			StartChasing();
 		}
@@ -334,24 +929,22 @@ void ABaseEnemy::OnPawnSeen(APawn* SeenPawn)
 
 void ABaseEnemy::OnPawnLost(APawn* LostPawn)
 {
+	LOGIC_COMBAT_SCOPE(STAT_LogicEnemySensing);
+	INC_DWORD_STAT(STAT_LogicNumSensingEvents);
+
+	if (!HasAuthority()) return;
+
 	if (LostPawn == TargetPlayer)
 	{
 		// 일정 시간 후에 타겟을 잃도록 설정 (즉시 잃지 않음)
-		FTimerHandle LoseTargetTimer;
-		GetWorldTimerManager().SetTimer(LoseTargetTimer, [this]()
-		{
-			StopChasing();
-		}, 3.0f, false);
+		SetCombatTimer(LoseTargetTimerHandle, ECombatTimerEvent::LoseTarget, 3.0f);
 	}
 }
 
 void ABaseEnemy::UpdateHealthBar()
 {
-	// 체력바 위젯 업데이트 (블루프린트에서 구현)
-	if (HealthBarWidget && HealthBarWidget->GetWidget())
-	{
-		// 블루프린트 위젯에서 UpdateHealthBar 함수 호출 등
-	}
+	// 비율만 캐시해두고 실제 그리기는 UEnemyHealthBarOverlay에서 한 번에
+	HealthBarPercent = MaxHealth > 0.0f ? FMath::Clamp(CurrentHealth / MaxHealth, 0.0f, 1.0f) : 0.0f;
 }
 
 void ABaseEnemy::OnStunEnd()
@@ -359,10 +952,7 @@ void ABaseEnemy::OnStunEnd()
 	bIsStunned = false;
 	
 	// AI 재시작
-	if (EnemyAIController && EnemyAIController->BrainComponent->IsPaused())
-	{
-		EnemyAIController->BrainComponent->ResumeLogic("StunEnd");
-	}
+	ResumeAI(TEXT("StunEnd"));
 
 	// 이전 상태로 복귀 또는 Idle 상태로
 	if (TargetPlayer)
@@ -4,15 +4,17 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
-#include "Components/WidgetComponent.h"
 #include "Engine/Engine.h"
+#include "EnemyLODSubsystem.h"
+#include "EnemyArchetype.h"
+#include "CombatTimerSubsystem.h"
 #include "BaseEnemy.generated.h"
 
 class UBehaviorTree;
 class UBlackboardComponent;
 class AAIController;
 class UPawnSensingComponent;
-class UWidgetComponent;
+struct FEnemyPersistedState;
 
 // 적 상태 열거형
 UENUM(BlueprintType)
@@ -26,16 +28,6 @@ enum class EEnemyState : uint8
 	Dead        UMETA(DisplayName = "Dead")
 };
 
-// 적 등급 열거형
-UENUM(BlueprintType)
-enum class EEnemyRank : uint8
-{
-	Normal      UMETA(DisplayName = "Normal"),
-	Elite       UMETA(DisplayName = "Elite"),
-	Boss        UMETA(DisplayName = "Boss"),
-	MiniBoss    UMETA(DisplayName = "MiniBoss")
-};
-
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEnemyDeath, ABaseEnemy*, DeadEnemy);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEnemyTakeDamage, ABaseEnemy*, Enemy, float, Damage);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEnemyStateChanged, EEnemyState, NewState);
@@ -50,15 +42,23 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
 public:
+	// === 네트워크 ===
+	// 복제 프로퍼티는 푸시 모델 (값을 바꾸는 곳에서만 dirty 표시)
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// 적 레지스트리에 캐시된 위치로 거리 판정 (쫓고 있는 플레이어에게는 항상 관련)
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+
 	// === 스탯 관련 ===
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Stats")
 	float MaxHealth = 100.0f;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy Stats")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_CurrentHealth, Category = "Enemy Stats")
 	float CurrentHealth;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Stats")
@@ -82,15 +82,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Stats")
 	EEnemyRank EnemyRank = EEnemyRank::Normal;
 
+	// 지정하면 위 스탯 대신 아키타입의 미리 계산된 스탯 블록을 사용
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Stats")
+	TObjectPtr<UEnemyArchetype> Archetype;
+
+	// 현재 적용된 공유 스탯 블록 (아키타입이 없으면 nullptr). 테이블이 다시 만들어질 수 있으므로 호출할 때마다 찾고 보관하지 않음
+	const FEnemyStatBlock* GetStatBlock() const;
+
 protected:
 	// === 상태 관리 ===
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy State")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_CurrentState, Category = "Enemy State")
 	EEnemyState CurrentState = EEnemyState::Idle;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy State")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_IsDead, Category = "Enemy State")
 	bool bIsDead = false;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy State")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Replicated, Category = "Enemy State")
 	bool bIsStunned = false;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy State")
@@ -100,6 +107,18 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
 	UBehaviorTree* BehaviorTree;
 
+	// true면 Normal 등급은 Behavior Tree 대신 UEnemyStateMachineSubsystem의 네이티브 상태 머신 사용
+	// (기존 블루프린트의 Behavior Tree를 조용히 대체하지 않도록 적 블루프린트마다 켬)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI")
+	bool bUseNativeStateMachine = false;
+
+	// true면 네이티브 상태 머신 적은 가까운 적과 분대(UEnemySquadSubsystem)를 이뤄 타겟/공격 순서를 공유
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI")
+	bool bJoinSquad = true;
+
+	// 스턴/점프 공격 등으로 AI가 멈춘 상태 (BT와 네이티브 상태 머신 공통)
+	bool bAIPaused = false;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI")
 	AAIController* EnemyAIController;
 
@@ -110,16 +129,26 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Detection")
 	UPawnSensingComponent* PawnSensingComponent;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Detection")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Replicated, Category = "Detection")
 	APawn* TargetPlayer;
 
+	FCombatTimerHandle LoseTargetTimerHandle;
+
 	// === UI 관련 ===
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UI")
-	UWidgetComponent* HealthBarWidget;
+	// 체력바 위치 (액터 기준). 체력바는 UEnemyHealthBarOverlay가 한 번에 그림
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI")
+	FVector HealthBarOffset = FVector(0.0f, 0.0f, 100.0f);
+
+	// 마지막 데미지/회복 시점의 체력 비율 (그릴 때 다시 계산하지 않음)
+	float HealthBarPercent = 1.0f;
 
-	// === 타이머 ===
-	FTimerHandle StunTimerHandle;
-	FTimerHandle AttackCooldownHandle;
+	// LOD 버킷 설정 (Far/Dormant에서는 숨김)
+	bool bShowHealthBar = true;
+
+	// === 타이머 (UCombatTimerSubsystem) ===
+	FCombatTimerHandle StunTimerHandle;
+	FCombatTimerHandle AttackCooldownHandle;
+	FCombatTimerHandle DespawnTimerHandle;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
 	float AttackCooldown = 2.0f;
@@ -127,7 +156,37 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Combat")
 	bool bCanAttack = true;
 
+	// === 성능 ===
+	// true면 액터 Tick 대신 UEnemyBatchUpdateSubsystem이 거리 기반 상태 전환을 일괄 처리
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Performance")
+	bool bUseBatchedUpdate = false;
+
+	// === 오브젝트 풀 ===
+	// UEnemyPoolSubsystem이 생성한 적 (죽으면 Destroy 대신 풀로 반납)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Performance")
+	bool bPooled = false;
+
+	// 풀에서 대기 중 (비활성)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Performance")
+	bool bInPool = false;
+
+	// 현재 LOD 버킷 (UEnemyLODSubsystem이 갱신)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Performance")
+	EEnemyLODBucket LODBucket = EEnemyLODBucket::Near;
+
 public:
+	// true면 PawnSensingComponent 대신 UEnemyPerceptionSubsystem이 일괄 감지 (시야에서 벗어나면 OnPawnLost도 받음)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Detection")
+	bool bUseSharedPerception = false;
+
+	// false면 거리와 상관없이 항상 최고 빈도로 업데이트 (보스 등)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Performance")
+	bool bUseSignificanceLOD = true;
+
+	// true면 플레이어에게서 멀어졌을 때 UEnemyCrowdSubsystem의 프록시로 강등될 수 있음
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Performance")
+	bool bAllowCrowdProxy = false;
+
 	// === 델리게이트 ===
 	UPROPERTY(BlueprintAssignable)
 	FOnEnemyDeath OnEnemyDeath;
@@ -142,10 +201,18 @@ public:
 	// Unreal Engine의 표준 TakeDamage 함수 오버라이드
 	virtual float TakeDamage(float DamageAmount, const struct FDamageEvent& DamageEvent, class AController* EventInstigator, AActor* DamageCauser) override;
 
-	// 간편한 데미지 함수 (블루프린트용)
+	// 간편한 데미지 함수 (블루프린트용). UCombatEventSubsystem에 쌓였다가 프레임마다 합산 적용됨
 	UFUNCTION(BlueprintCallable, Category = "Enemy Combat")
 	virtual void ApplyDamage(float DamageAmount, AActor* DamageDealer);
 
+	// 이번 프레임에 모인 데미지를 한 번에 적용 (체력/타겟/사망). 적용했으면 true
+	virtual bool ApplyCoalescedDamage(float TotalDamage, AActor* DamageDealer);
+
+	// 합쳐진 알림 전달 (델리게이트, 블루프린트 이벤트, 체력바)
+	void NotifyDamageTaken(float TotalDamage);
+	void NotifyStateChanged(EEnemyState NewState);
+	void NotifyDeath();
+
 	UFUNCTION(BlueprintCallable, Category = "Enemy Combat")
 	virtual void Die();
 
@@ -183,9 +250,54 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Enemy Combat")
 	bool CanAttack() const { return bCanAttack && !bIsDead && !bIsStunned; }
 
+	float GetAttackCooldown() const { return AttackCooldown; }
+
 	UFUNCTION(BlueprintPure, Category = "Enemy Combat")
 	float GetDistanceToTarget() const;
 
+	UFUNCTION(BlueprintPure, Category = "Performance")
+	EEnemyLODBucket GetLODBucket() const { return LODBucket; }
+
+	// === 체력바 (UEnemyHealthBarOverlay) ===
+	float GetHealthBarPercent() const { return HealthBarPercent; }
+	bool ShouldShowHealthBar() const { return bShowHealthBar && !bIsDead && !bInPool; }
+	FVector GetHealthBarLocation() const { return GetActorLocation() + HealthBarOffset; }
+
+	// === AI 실행 ===
+	// Elite 이상은 항상 Behavior Tree
+	bool UsesNativeStateMachine() const { return bUseNativeStateMachine && EnemyRank == EEnemyRank::Normal; }
+	bool IsAIPaused() const { return bAIPaused; }
+
+	void PauseAI(const FString& Reason);
+	void ResumeAI(const FString& Reason);
+	void StopAI(const FString& Reason);
+
+	// === 오브젝트 풀 ===
+	void SetPooled(bool bInPooled) { bPooled = bInPooled; }
+	bool IsPooled() const { return bPooled; }
+	bool IsInPool() const { return bInPool; }
+
+	// 풀에 넣기 전 비활성화 (숨김, 충돌/Tick/AI 정지, 서브시스템 등록 해제)
+	virtual void DeactivateForPool();
+
+	// 풀에서 꺼낼 때 호출: 스탯/상태 초기화 후 Behavior Tree 재시작
+	virtual void ResetForReuse();
+
+	// 크라우드 프록시에서 승격될 때 호출: 레벨/등급 스탯 적용 후 프록시의 상태/체력을 이어받음
+	void RestoreFromCrowd(int32 InLevel, EEnemyRank InRank, EEnemyState InState, float InHealth);
+
+	// 언로드됐던 스트리밍 셀에서 돌아올 때 호출: 저장된 위치/체력/상태를 이어받음 (초기화는 이미 끝난 상태)
+	void ApplyPersistedState(const FEnemyPersistedState& State);
+
+	// 공용 감지 서비스에서 보임/안보임이 바뀌었을 때 호출
+	void HandleSharedPerception(APawn* Pawn, bool bSeen);
+
+	// LOD 버킷 변경 시 액터/컴포넌트 업데이트 빈도 적용 (자식 클래스에서 확장 가능)
+	virtual void ApplyLODBucket(EEnemyLODBucket NewBucket, const FEnemyLODBucketSettings& Settings);
+
+	// UCombatTimerSubsystem에서 만료된 타이머 전달 (자식 클래스는 자기 이벤트를 처리하고 나머지는 Super로)
+	virtual void OnCombatTimer(ECombatTimerEvent Event);
+
 protected:
 	// === 보호된 함수들 ===
 	UFUNCTION()
@@ -202,6 +314,39 @@ protected:
 	virtual void OnStunEnd();
 	virtual void OnAttackCooldownEnd();
 
+	// 사망 후 풀 반납 또는 Destroy
+	void Despawn();
+
+	// 전투 타이머 헬퍼 (서브시스템이 없으면 아무것도 하지 않음)
+	void SetCombatTimer(FCombatTimerHandle& Handle, ECombatTimerEvent Event, float Delay);
+	void ClearCombatTimer(FCombatTimerHandle& Handle);
+	bool IsCombatTimerActive(const FCombatTimerHandle& Handle) const;
+
+	// 이 적의 전투 타이머 전부 취소 (풀 반납/재사용/EndPlay)
+	virtual void ClearCombatTimers();
+
+	void RegisterWithSubsystems();
+	void UnregisterFromSubsystems();
+
+	// Idle/Dead면 휴면, 그 외에는 깨어 있음 (서버만)
+	void UpdateNetDormancy();
+
+	// Idle에서도 스스로 움직이는 적(바운스 등)은 false로 오버라이드해 Idle 중에도 이동을 복제
+	virtual bool CanSleepWhileIdle() const { return true; }
+
+	// 휴면 중 값이 바뀌었으면 한 번 전송
+	void FlushReplicatedState();
+
+	// === 복제 알림 (클라이언트) ===
+	UFUNCTION()
+	void OnRep_CurrentHealth();
+
+	UFUNCTION()
+	void OnRep_CurrentState();
+
+	UFUNCTION()
+	void OnRep_IsDead();
+
 	// === 블루프린트 이벤트 ===
 	UFUNCTION(BlueprintImplementableEvent, Category = "Enemy Events")
 	void OnDeathEvent();
@@ -220,4 +365,20 @@ protected:
 
 	UFUNCTION(BlueprintImplementableEvent, Category = "Enemy Events")
 	void OnTargetLostEvent();
-}; 
\ No newline at end of file
+
+private:
+	void ApplyStatBlock(const FEnemyStatBlock& Stats);
+
+	// 아키타입이 없을 때 레벨/등급 배율을 적용할 원본 값 (InitializeStats가 여러 번 불려도 중복 적용 안 되게)
+	FEnemyStatBlock InstanceBaseStats;
+
+	// 공유 스탯 블록을 찾을 때 쓰는 레벨/등급 (InitializeStats에서 적용한 값)
+	int32 StatBlockLevel = 1;
+	EEnemyRank StatBlockRank = EEnemyRank::Normal;
+
+	// 처음 초기화될 때의 레벨/등급 (크라우드/셀 복원이 바꾼 값을 풀 재사용 시 되돌림)
+	int32 BaseLevel = 1;
+	EEnemyRank BaseRank = EEnemyRank::Normal;
+	TEnumAsByte<ECollisionEnabled::Type> SavedCapsuleCollision = ECollisionEnabled::QueryAndPhysics;
+	TEnumAsByte<ECollisionEnabled::Type> SavedMeshCollision = ECollisionEnabled::QueryOnly;
+};
@@ -1,18 +1,22 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "BasicSlime.h"
+#include "EnemyRegistrySubsystem.h"
+#include "LogicReplaySubsystem.h"
+#include "LogicMemory.h"
 #include "AIController.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Engine/Engine.h"
-#include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "DrawDebugHelpers.h"
 
 ABasicSlime::ABasicSlime()
 {
+	LLM_SCOPE_BYTAG(Logic_Enemies_BasicSlime);
+
 	// 슬라임 기본 스탯 설정
 	MaxHealth = 60.0f;
 	AttackDamage = 15.0f;
@@ -39,6 +43,12 @@ ABasicSlime::ABasicSlime()
 void ABasicSlime::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// 셀에 사망으로 저장돼 있던 적은 기본 클래스에서 이미 제거됨
+	if (bIsDead || IsActorBeingDestroyed())
+	{
+		return;
+	}
 	
 	// 바운스 효과 시작
 	StartBounceEffect();
@@ -49,7 +59,7 @@ void ABasicSlime::Attack()
 	if (!CanAttack() || !TargetPlayer) return;
 
 	// 50% 확률로 점프 공격 또는 일반 공격
-	if (bCanJumpAttack && FMath::RandBool())
+	if (bCanJumpAttack && ULogicReplaySubsystem::RandBool(this))
 	{
 		PerformJumpAttack();
 	}
@@ -69,6 +79,69 @@ void ABasicSlime::Attack()
 	}
 }
 
+void ABasicSlime::ApplyLODBucket(EEnemyLODBucket NewBucket, const FEnemyLODBucketSettings& Settings)
+{
+	Super::ApplyLODBucket(NewBucket, Settings);
+
+	// 아무도 보지 않는 거리에서는 바운스 연출이 의미 없음
+	if (NewBucket == EEnemyLODBucket::Dormant)
+	{
+		ClearCombatTimer(BounceTimerHandle);
+	}
+	else if (!bIsDead && !IsCombatTimerActive(BounceTimerHandle))
+	{
+		StartBounceEffect();
+	}
+}
+
+void ABasicSlime::OnCombatTimer(ECombatTimerEvent Event)
+{
+	switch (Event)
+	{
+	case ECombatTimerEvent::JumpAttackCooldownEnd:
+		OnJumpAttackCooldownEnd();
+		break;
+	case ECombatTimerEvent::Bounce:
+		PerformBounce();
+		break;
+	case ECombatTimerEvent::JumpAttackTimeout:
+		EndJumpAttack();
+		break;
+	default:
+		Super::OnCombatTimer(Event);
+		break;
+	}
+}
+
+void ABasicSlime::ClearCombatTimers()
+{
+	Super::ClearCombatTimers();
+
+	ClearCombatTimer(BounceTimerHandle);
+	ClearCombatTimer(JumpCooldownTimerHandle);
+	ClearCombatTimer(JumpTimeoutTimerHandle);
+}
+
+void ABasicSlime::Die()
+{
+	// 죽은 뒤에는 AI를 다시 켜지 않도록 상태만 정리
+	bIsJumpAttacking = false;
+	ClearCombatTimer(JumpTimeoutTimerHandle);
+
+	Super::Die();
+}
+
+void ABasicSlime::ResetForReuse()
+{
+	bIsJumpAttacking = false;
+	bCanJumpAttack = true;
+
+	Super::ResetForReuse();
+
+	// ClearCombatTimers로 멈춘 바운스 재시작
+	StartBounceEffect();
+}
+
 void ABasicSlime::PerformJumpAttack()
 {
 	if (!TargetPlayer || bIsJumpAttacking) return;
@@ -77,10 +150,7 @@ void ABasicSlime::PerformJumpAttack()
 	bCanJumpAttack = false;
 
 	// AI 일시 정지 (점프 공격 중)
-	if (EnemyAIController)
-	{
-		EnemyAIController->BrainComponent->PauseLogic("JumpAttack");
-	}
+	PauseAI(TEXT("JumpAttack"));
 
 	// 타겟 방향으로 점프
 	FVector TargetLocation = TargetPlayer->GetActorLocation();
@@ -94,78 +164,96 @@ void ABasicSlime::PerformJumpAttack()
 		GetCharacterMovement()->AddImpulse(JumpVelocity, true);
 	}
 
-	// 착지 감지를 위한 타이머 설정
-	GetWorldTimerManager().SetTimer(JumpAttackTimerHandle, this, &ABasicSlime::HandleJumpLanding, 0.1f, true);
+	// 착지는 Landed()에서 처리 (폴링 타이머 없음). 착지하지 못할 때를 대비한 안전 타이머만 둠
+	SetCombatTimer(JumpTimeoutTimerHandle, ECombatTimerEvent::JumpAttackTimeout, JumpAttackTimeout);
 
 	// 점프 공격 쿨다운 타이머
-	FTimerHandle JumpCooldownTimer;
-	GetWorldTimerManager().SetTimer(JumpCooldownTimer, this, &ABasicSlime::OnJumpAttackCooldownEnd, JumpAttackCooldown, false);
+	SetCombatTimer(JumpCooldownTimerHandle, ECombatTimerEvent::JumpAttackCooldownEnd, JumpAttackCooldown);
 
 	// 블루프린트 이벤트 호출
 	OnAttackEvent();
 }
 
+void ABasicSlime::Landed(const FHitResult& Hit)
+{
+	Super::Landed(Hit);
+
+	if (bIsJumpAttacking)
+	{
+		HandleJumpLanding();
+	}
+}
+
 void ABasicSlime::HandleJumpLanding()
 {
-	// 땅에 착지했는지 확인
-	if (GetCharacterMovement() && GetCharacterMovement()->IsMovingOnGround())
+	if (!bIsJumpAttacking)
 	{
-		bIsJumpAttacking = false;
-		
-		// 타이머 정리
-		GetWorldTimerManager().ClearTimer(JumpAttackTimerHandle);
+		return;
+	}
 
-		// AI 재개
-		if (EnemyAIController && EnemyAIController->BrainComponent->IsPaused())
-		{
-			EnemyAIController->BrainComponent->ResumeLogic("JumpAttackEnd");
-		}
+	bIsJumpAttacking = false;
+	ClearCombatTimer(JumpTimeoutTimerHandle);
+
+	// AI 재개
+	ResumeAI(TEXT("JumpAttackEnd"));
+
+	// 착지 지점 주변의 플레이어에게 데미지 (등록된 플레이어만 거리로 판정, 물리 스윕 없음)
+	const FVector LandingLocation = GetActorLocation();
 
-		// 착지 지점 주변의 적들에게 데미지
-		TArray<FHitResult> HitResults;
-		FVector StartLocation = GetActorLocation();
-		FVector EndLocation = StartLocation + FVector(0, 0, -10);
-
-		// 구체 형태로 충돌 감지
-		FCollisionShape CollisionShape = FCollisionShape::MakeSphere(JumpAttackRadius);
-		FCollisionQueryParams QueryParams;
-		QueryParams.AddIgnoredActor(this);
-
-		bool bHit = GetWorld()->SweepMultiByChannel(
-			HitResults,
-			StartLocation,
-			EndLocation,
-			FQuat::Identity,
-			ECollisionChannel::ECC_Pawn,
-			CollisionShape,
-			QueryParams
-		);
-
-		if (bHit)
+	if (const UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		for (APawn* Player : Registry->GetRegisteredPlayers())
 		{
-			for (const FHitResult& Hit : HitResults)
+			if (!Player || !Player->ActorHasTag("Player"))
 			{
-				if (AActor* HitActor = Hit.GetActor())
+				continue;
+			}
+
+			// 캡슐 반경만큼 범위를 넓혀서 기존 구체 스윕과 비슷하게 판정
+			const float HitRadius = JumpAttackRadius + Player->GetSimpleCollisionRadius();
+			if (FVector::DistSquared(LandingLocation, Player->GetActorLocation()) > FMath::Square(HitRadius))
+			{
+				continue;
+			}
+
+			// 시야 확인이 필요한 경우에만 트레이스
+			if (bJumpAttackRequiresLineOfSight)
+			{
+				FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SlimeJumpAttackSight), false, this);
+				QueryParams.AddIgnoredActor(Player);
+				if (GetWorld()->LineTraceTestByChannel(LandingLocation, Player->GetActorLocation(), ECC_Visibility, QueryParams))
 				{
-					// 플레이어에게 데미지 적용
-					if (HitActor->ActorHasTag("Player"))
-					{
-						// 실제 데미지 적용
-						// UGameplayStatics::ApplyDamage(HitActor, AttackDamage * 1.5f, GetController(), this, UDamageType::StaticClass());
-						
-						UE_LOG(LogTemp, Warning, TEXT("BasicSlime jump attack hit player for %f damage!"), AttackDamage * 1.5f);
-					}
+					continue;
 				}
 			}
-		}
 
-		// 디버그 시각화 (개발 중에만)
-		#if WITH_EDITOR
-		if (GetWorld())
-		{
-			DrawDebugSphere(GetWorld(), StartLocation, JumpAttackRadius, 12, FColor::Red, false, 2.0f);
+			// 실제 데미지 적용
+			// UGameplayStatics::ApplyDamage(Player, AttackDamage * 1.5f, GetController(), this, UDamageType::StaticClass());
+
+			UE_LOG(LogTemp, Warning, TEXT("BasicSlime jump attack hit player for %f damage!"), AttackDamage * 1.5f);
 		}
-		#endif
+	}
+
+	// 디버그 시각화 (개발 중에만)
+	#if WITH_EDITOR
+	if (GetWorld())
+	{
+		DrawDebugSphere(GetWorld(), LandingLocation, JumpAttackRadius, 12, FColor::Red, false, 2.0f);
+	}
+	#endif
+}
+
+void ABasicSlime::EndJumpAttack()
+{
+	if (!bIsJumpAttacking)
+	{
+		return;
+	}
+
+	bIsJumpAttacking = false;
+	if (!bIsDead)
+	{
+		ResumeAI(TEXT("JumpAttackTimeout"));
 	}
 }
 
@@ -177,18 +265,18 @@ void ABasicSlime::OnJumpAttackCooldownEnd()
 void ABasicSlime::StartBounceEffect()
 {
 	// 주기적으로 살짝 바운스하는 효과
-	GetWorldTimerManager().SetTimer(BounceTimerHandle, this, &ABasicSlime::PerformBounce, 
-		FMath::RandRange(2.0f, 4.0f), true);
+	SetCombatTimer(BounceTimerHandle, ECombatTimerEvent::Bounce, ULogicReplaySubsystem::RandRange(this, 2.0f, 4.0f));
 }
 
 void ABasicSlime::PerformBounce()
 {
-	// 죽었거나 공격 중이면 바운스하지 않음
-	if (bIsDead || bIsJumpAttacking || CurrentState == EEnemyState::Attacking) 
+	// 죽었으면 바운스 중단 (클라이언트는 서버 이동 복제를 따름)
+	if (bIsDead || !HasAuthority())
 		return;
 
-	// 땅에 있을 때만 바운스
-	if (GetCharacterMovement() && GetCharacterMovement()->IsMovingOnGround())
+	// 공격 중이면 이번 바운스만 건너뜀, 땅에 있을 때만 바운스
+	const bool bBusy = bIsJumpAttacking || CurrentState == EEnemyState::Attacking;
+	if (!bBusy && GetCharacterMovement() && GetCharacterMovement()->IsMovingOnGround())
 	{
 		// 작은 점프로 바운스 효과
 		FVector BounceVelocity = FVector(0, 0, BounceHeight);
@@ -196,6 +284,5 @@ void ABasicSlime::PerformBounce()
 	}
 
 	// 다음 바운스 시간 랜덤 설정
-	GetWorldTimerManager().SetTimer(BounceTimerHandle, this, &ABasicSlime::PerformBounce, 
-		FMath::RandRange(2.0f, 4.0f), false);
+	StartBounceEffect();
 } 
\ No newline at end of file
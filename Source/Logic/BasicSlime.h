@@ -18,12 +18,28 @@ class LOGIC_API ABasicSlime : public ABaseEnemy
 public:
 	ABasicSlime();
 
+	// 풀에서 재사용될 때 점프 공격 상태/바운스 타이머 복구
+	virtual void ResetForReuse() override;
+
+	// 공중에서 죽으면 Landed가 오지 않으므로 점프 공격 상태 정리
+	virtual void Die() override;
+
 protected:
 	virtual void BeginPlay() override;
 
 	// 공격 오버라이드
 	virtual void Attack() override;
 
+	// Dormant 버킷에서는 바운스 타이머를 멈춤
+	virtual void ApplyLODBucket(EEnemyLODBucket NewBucket, const FEnemyLODBucketSettings& Settings) override;
+
+	// 점프 공격 쿨다운/바운스 타이머 처리
+	virtual void OnCombatTimer(ECombatTimerEvent Event) override;
+	virtual void ClearCombatTimers() override;
+
+	// Idle 중에도 바운스하므로 휴면하지 않음 (휴면하면 바운스 이동이 복제되지 않음)
+	virtual bool CanSleepWhileIdle() const override { return false; }
+
 	// 점프 공격 관련
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slime Combat")
 	float JumpAttackForce = 600.0f;
@@ -31,6 +47,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slime Combat")
 	float JumpAttackRadius = 150.0f;
 
+	// 이 시간(초) 안에 착지하지 못하면 (막힌 점프, 바닥 없는 낭떠러지) 점프 공격을 끝내고 AI 재개
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slime Combat")
+	float JumpAttackTimeout = 3.0f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slime Combat")
 	bool bCanJumpAttack = true;
 
@@ -42,6 +62,13 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Slime Combat")
 	void HandleJumpLanding();
 
+	// 착지 이벤트 (CharacterMovement가 Falling -> Walking 전환 시 호출)
+	virtual void Landed(const FHitResult& Hit) override;
+
+	// true면 범위 안의 플레이어에 대해 벽 뒤인지 라인 트레이스로 한 번 더 확인
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slime Combat")
+	bool bJumpAttackRequiresLineOfSight = false;
+
 	// 슬라임 특성
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slime Properties")
 	float BounceHeight = 50.0f;
@@ -50,9 +77,6 @@ protected:
 	float BounceDamping = 0.5f;
 
 private:
-	// 점프 공격 타이머
-	FTimerHandle JumpAttackTimerHandle;
-	
 	// 점프 공격 중인지 확인
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Slime State", meta = (AllowPrivateAccess = "true"))
 	bool bIsJumpAttacking = false;
@@ -67,6 +91,11 @@ private:
 	// 주기적인 바운스 효과
 	void StartBounceEffect();
 	
-	FTimerHandle BounceTimerHandle;
+	FCombatTimerHandle BounceTimerHandle;
+	FCombatTimerHandle JumpCooldownTimerHandle;
+	FCombatTimerHandle JumpTimeoutTimerHandle;
+
+	// 착지 없이 점프 공격 종료 (데미지 판정 없음)
+	void EndJumpAttack();
 	void PerformBounce();
 }; 
\ No newline at end of file
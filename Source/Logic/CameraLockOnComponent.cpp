@@ -1,20 +1,35 @@
 #include "CameraLockOnComponent.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/SpringArmComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "BaseEnemy.h"
+#include "EnemyRegistrySubsystem.h"
 #include "GameFramework/Controller.h"
+#include "GameFramework/PlayerController.h"
 #include "DrawDebugHelpers.h"
+#include "LogicStats.h"
+#include "LogicMemory.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/GameViewportClient.h"
+#include "SceneView.h"
+#include "Math/VectorRegister.h"
 
 UCameraLockOnComponent::UCameraLockOnComponent()
 {
+    LLM_SCOPE_BYTAG(Logic_LockOn);
+
+    // 락온 중이거나 카메라 재정렬 중일 때만 Tick (SetLockOnState에서 켜고 끔)
     PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
     CurrentLockOnState = ELockOnState::None;
     CurrentTarget = nullptr;
+
+    OcclusionTraceDelegate.BindUObject(this, &UCameraLockOnComponent::OnOcclusionTraceCompleted);
 }
 
 void UCameraLockOnComponent::BeginPlay()
 {
+    LLM_SCOPE_BYTAG(Logic_LockOn);
+
     Super::BeginPlay();
 
     // 컴포넌트 참조 가져오기
@@ -24,21 +39,8 @@ void UCameraLockOnComponent::BeginPlay()
         SpringArm = OwnerPawn->FindComponentByClass<USpringArmComponent>();
         Camera = OwnerPawn->FindComponentByClass<UCameraComponent>();
         
-        // 카메라 컴포넌트 찾기
-        TArray<UCameraComponent*> CameraComponents;
-        OwnerPawn->GetComponents<UCameraComponent>(CameraComponents);
-        
-        for (UCameraComponent* Cam : CameraComponents)
-        {
-            if (Cam->GetName().Contains(TEXT("Combat")))
-            {
-                CombatCamera = Cam;
-            }
-            else if (Cam->GetName().Contains(TEXT("Move")))
-            {
-                MoveCamera = Cam;
-            }
-        }
+        // 카메라 컴포넌트 찾기 (이름 검색은 여기서 한 번만)
+        CacheCameraComponents();
 
         // 초기 카메라 설정
         if (SpringArm)
@@ -48,120 +50,137 @@ void UCameraLockOnComponent::BeginPlay()
         }
 
         // 초기에는 이동 카메라 활성화
-        if (MoveCamera)
+        ApplyCameraMode(false);
+    }
+
+    UpdateTickEnabled();
+}
+
+void UCameraLockOnComponent::CacheCameraComponents()
+{
+    TArray<UCameraComponent*> CameraComponents;
+    OwnerPawn->GetComponents<UCameraComponent>(CameraComponents);
+
+    for (UCameraComponent* Cam : CameraComponents)
+    {
+        if (Cam->GetName().Contains(TEXT("Combat")))
         {
-            MoveCamera->SetActive(true);
+            CombatCamera = Cam;
         }
-        if (CombatCamera)
+        else if (Cam->GetName().Contains(TEXT("Move")))
         {
-            CombatCamera->SetActive(false);
+            MoveCamera = Cam;
         }
     }
 }
 
-void UCameraLockOnComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UCameraLockOnComponent::ApplyCameraMode(bool bCombat)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    // 카메라 컴포넌트 유효성 검사
-    if (!CombatCamera || !MoveCamera)
+    if (MoveCamera)
     {
-        TArray<UCameraComponent*> CameraComponents;
-        OwnerPawn->GetComponents<UCameraComponent>(CameraComponents);
-        
-        for (UCameraComponent* Cam : CameraComponents)
-        {
-            if (Cam->GetName().Contains(TEXT("Combat")))
-            {
-                CombatCamera = Cam;
-            }
-            else if (Cam->GetName().Contains(TEXT("Move")))
-            {
-                MoveCamera = Cam;
-            }
-        }
+        MoveCamera->SetActive(!bCombat);
+    }
+    if (CombatCamera)
+    {
+        CombatCamera->SetActive(bCombat);
     }
+}
 
-    // 현재 활성화된 카메라 정보 표시
-    bool bCombatCameraActive = CombatCamera && CombatCamera->IsActive() && CombatCamera->IsVisible();
-    bool bMoveCameraActive = MoveCamera && MoveCamera->IsActive() && MoveCamera->IsVisible();
+void UCameraLockOnComponent::SetLockOnState(ELockOnState NewState)
+{
+    CurrentLockOnState = NewState;
 
-    // 카메라 상태 디버그 메시지
-    FString CameraState = FString::Printf(TEXT("Camera State - Combat: %s, Move: %s"), 
-        bCombatCameraActive ? TEXT("Active") : TEXT("Inactive"),
-        bMoveCameraActive ? TEXT("Active") : TEXT("Inactive"));
-    GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::White, CameraState);
+    // 카메라 전환은 상태가 바뀔 때만
+    ApplyCameraMode(NewState != ELockOnState::None);
 
-    // 카메라 상태 확인 및 자동 활성화
-    if (!bCombatCameraActive && !bMoveCameraActive)
-    {
-        // 두 카메라 모두 비활성화된 경우
-        if (CurrentLockOnState == ELockOnState::Locked || CurrentLockOnState == ELockOnState::Searching)
-        {
-            if (CombatCamera)
-            {
-                CombatCamera->SetActive(true);
-                if (MoveCamera) MoveCamera->SetActive(false);
-                GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Red, TEXT("Current Camera: Combat Camera (Auto-activated)"));
-            }
-        }
-        else
-        {
-            if (MoveCamera)
-            {
-                MoveCamera->SetActive(true);
-                if (CombatCamera) CombatCamera->SetActive(false);
-                GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Green, TEXT("Current Camera: Movement Camera (Auto-activated)"));
-            }
-        }
-    }
-    else if (bCombatCameraActive && bMoveCameraActive)
+    // 락온이 끝나면 이동 카메라가 플레이어를 다시 화면 중앙에 둘 때까지 Tick
+    bRecentering = NewState == ELockOnState::None;
+
+    UpdateTickEnabled();
+    OnLockOnStateChanged.Broadcast(CurrentLockOnState);
+}
+
+void UCameraLockOnComponent::EndLockOn()
+{
+    RestoreOriginalCameraSettings();
+
+    CurrentTarget = nullptr;
+    TimeOutOfView = 0.0f;
+    SearchTimer = 0.0f;
+
+    OnLockOnTargetChanged.Broadcast(nullptr);
+    SetLockOnState(ELockOnState::None);
+}
+
+void UCameraLockOnComponent::UpdateTickEnabled()
+{
+    bool bShouldTick = CurrentLockOnState != ELockOnState::None || bRecentering;
+#if LOGIC_WITH_DEBUG_OVERLAY
+    bShouldTick |= bShowDebugInfo;
+#endif
+
+    if (IsComponentTickEnabled() != bShouldTick)
     {
-        // 두 카메라 모두 활성화된 경우
-        if (CurrentLockOnState == ELockOnState::Locked || CurrentLockOnState == ELockOnState::Searching)
-        {
-            if (MoveCamera) MoveCamera->SetActive(false);
-        }
-        else
-        {
-            if (CombatCamera) CombatCamera->SetActive(false);
-        }
+        SetComponentTickEnabled(bShouldTick);
     }
+}
 
-    // 현재 활성화된 카메라 표시
-    if (bCombatCameraActive)
+void UCameraLockOnComponent::SetShowDebugInfo(bool bInShowDebugInfo)
+{
+    bShowDebugInfo = bInShowDebugInfo;
+    UpdateTickEnabled();
+}
+
+bool UCameraLockOnComponent::UpdateRecenter(float DeltaTime)
+{
+    if (!SpringArm || !OwnerPawn->GetController())
     {
-        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Red, TEXT("Current Camera: Combat Camera"));
+        return false;
     }
-    else if (bMoveCameraActive)
+
+    // 플레이어가 화면 중앙에 오도록 카메라 위치 조정
+    FVector OwnerLocation = OwnerPawn->GetActorLocation();
+    FVector2D ScreenLocation;
+    if (!ProjectToScreen(OwnerLocation, ScreenLocation))
     {
-        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Green, TEXT("Current Camera: Movement Camera"));
+        return false;
     }
 
-    // 현재 타겟 정보 표시
-    if (CurrentTarget)
+    const FVector2D ViewportSize = GetViewCache().ViewportSize;
+    FVector2D CenterOffset = ScreenLocation - (ViewportSize * 0.5f);
+    float DistanceFromCenter = CenterOffset.Size();
+
+    // 충분히 중앙이면 재정렬 종료
+    if (DistanceFromCenter <= ViewportSize.X * 0.2f)
     {
-        ABaseEnemy* Enemy = Cast<ABaseEnemy>(CurrentTarget);
-        if (Enemy)
-        {
-            FString TargetInfo = FString::Printf(TEXT("Current Target: %s (Enemy)"), *Enemy->GetName());
-            GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, TargetInfo);
-        }
-        else
-        {
-            // BaseEnemy가 아닌 경우 락온 해제
-            ToggleLockOn();
-            return;
-        }
+        return false;
     }
-    else if (CurrentLockOnState == ELockOnState::Searching)
+
+    FVector LookDir = (OwnerLocation - SpringArm->GetComponentLocation()).GetSafeNormal();
+    FRotator TargetRot = LookDir.Rotation();
+    FRotator CurrentRot = OwnerPawn->GetControlRotation();
+    FRotator NewRot = FMath::RInterpTo(CurrentRot, TargetRot, DeltaTime, CameraRotationInterpSpeed);
+    OwnerPawn->GetController()->SetControlRotation(NewRot);
+    return true;
+}
+
+void UCameraLockOnComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    LOGIC_COMBAT_SCOPE(STAT_LogicLockOnTick);
+
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (!OwnerPawn)
     {
-        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, TEXT("Searching for enemy target..."));
+        return;
     }
-    else
+
+#if LOGIC_WITH_DEBUG_OVERLAY
+    if (bShowDebugInfo)
     {
-        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, TEXT("No target"));
+        DrawDebugOverlay(CombatCamera && CombatCamera->IsActive(), MoveCamera && MoveCamera->IsActive());
     }
+#endif
 
     if (CurrentLockOnState == ELockOnState::Locked)
     {
@@ -201,25 +220,7 @@ void UCameraLockOnComponent::TickComponent(float DeltaTime, ELevelTick TickType,
         // 0.2초 이내에 타겟을 찾지 못하면 락온 해제
         if (SearchTimer >= 0.2f)
         {
-            // 타겟을 찾지 못한 경우 락온 해제
-            if (CombatCamera)
-            {
-                CombatCamera->SetActive(false);
-            }
-            if (MoveCamera)
-            {
-                MoveCamera->SetActive(true);
-            }
-            RestoreOriginalCameraSettings();
-            
-            CurrentTarget = nullptr;
-            CurrentLockOnState = ELockOnState::None;
-            TimeOutOfView = 0.0f;
-            SearchTimer = 0.0f;
-            
-            OnLockOnTargetChanged.Broadcast(nullptr);
-            OnLockOnStateChanged.Broadcast(CurrentLockOnState);
-            
+            EndLockOn();
             return;
         }
 
@@ -231,56 +232,28 @@ void UCameraLockOnComponent::TickComponent(float DeltaTime, ELevelTick TickType,
             if (BestTarget)
             {
                 CurrentTarget = BestTarget;
-                CurrentLockOnState = ELockOnState::Locked;
+                ResetOcclusionCache();
                 OnLockOnTargetChanged.Broadcast(CurrentTarget);
-                OnLockOnStateChanged.Broadcast(CurrentLockOnState);
+                SetLockOnState(ELockOnState::Locked);
             }
         }
     }
-    else if (CurrentLockOnState == ELockOnState::None)
+    else if (bRecentering)
     {
-        // 이동 카메라 상태에서의 카메라 업데이트
-        if (MoveCamera && MoveCamera->IsActive())
+        // 락온 해제 후 플레이어가 화면 중앙 근처로 돌아올 때까지 이동 카메라 재정렬
+        if (!UpdateRecenter(DeltaTime))
         {
-            // 플레이어가 화면 중앙에 오도록 카메라 위치 조정
-            FVector OwnerLocation = OwnerPawn->GetActorLocation();
-            FVector2D ScreenLocation;
-            if (UGameplayStatics::ProjectWorldToScreen(GetWorld()->GetFirstPlayerController(), OwnerLocation, ScreenLocation))
-            {
-                FVector2D ViewportSize;
-                GetWorld()->GetGameViewport()->GetViewportSize(ViewportSize);
-                
-                FVector2D CenterOffset = ScreenLocation - (ViewportSize * 0.5f);
-                float DistanceFromCenter = CenterOffset.Size();
-                
-                if (DistanceFromCenter > ViewportSize.X * 0.2f)
-                {
-                    FVector LookDir = (OwnerLocation - SpringArm->GetComponentLocation()).GetSafeNormal();
-                    FRotator TargetRot = LookDir.Rotation();
-                    FRotator CurrentRot = OwnerPawn->GetControlRotation();
-                    FRotator NewRot = FMath::RInterpTo(CurrentRot, TargetRot, DeltaTime, CameraRotationInterpSpeed);
-                    OwnerPawn->GetController()->SetControlRotation(NewRot);
-                }
-            }
-        }
-        else
-        {
-            // 이동 카메라가 활성화되지 않은 경우 활성화
-            if (MoveCamera)
-            {
-                MoveCamera->SetActive(true);
-            }
-            if (CombatCamera)
-            {
-                CombatCamera->SetActive(false);
-            }
+            bRecentering = false;
+            UpdateTickEnabled();
         }
     }
 
+#if LOGIC_WITH_DEBUG_OVERLAY
     if (bShowDebugInfo)
     {
         DrawDebugInfo();
     }
+#endif
 }
 
 void UCameraLockOnComponent::ToggleLockOn()
@@ -289,56 +262,17 @@ void UCameraLockOnComponent::ToggleLockOn()
 
     if (CurrentLockOnState == ELockOnState::Locked)
     {
-        // 락온 해제 시
-        // 1. 먼저 전투 카메라 비활성화
-        if (CombatCamera)
-        {
-            CombatCamera->SetActive(false);
-        }
-
-        // 2. 이동 카메라 활성화
-        if (MoveCamera)
-        {
-            MoveCamera->SetActive(true);
-        }
-
-        // 3. 카메라 설정 복구
-        RestoreOriginalCameraSettings();
-
-        // 4. 상태 초기화
-        CurrentTarget = nullptr;
-        CurrentLockOnState = ELockOnState::None;
-        TimeOutOfView = 0.0f;
-        SearchTimer = 0.0f;
-
-        // 5. 이벤트 브로드캐스트
-        OnLockOnTargetChanged.Broadcast(nullptr);
-        OnLockOnStateChanged.Broadcast(CurrentLockOnState);
+        // 락온 해제 시: 이동 카메라로 전환, 카메라 설정 복구, 상태 초기화
+        EndLockOn();
 
         UE_LOG(LogTemp, Log, TEXT("Lock-on toggled off"));
     }
     else
     {
-        // 락온 시작 시
-        // 1. 먼저 이동 카메라 비활성화
-        if (MoveCamera)
-        {
-            MoveCamera->SetActive(false);
-        }
-
-        // 2. 전투 카메라 활성화
-        if (CombatCamera)
-        {
-            CombatCamera->SetActive(true);
-        }
-
-        // 3. 락온 상태로 전환
-        CurrentLockOnState = ELockOnState::Searching;
+        // 락온 시작 시: 전투 카메라로 전환 후 타겟 검색
         SearchTimer = 0.0f;
         TimeOutOfView = 0.0f;
-
-        // 4. 이벤트 브로드캐스트
-        OnLockOnStateChanged.Broadcast(CurrentLockOnState);
+        SetLockOnState(ELockOnState::Searching);
 
         UE_LOG(LogTemp, Log, TEXT("Lock-on toggled on - searching for target"));
     }
@@ -367,10 +301,9 @@ void UCameraLockOnComponent::RestoreOriginalCameraSettings()
 
     // 4. 플레이어가 화면 중앙에 오도록 카메라 위치 조정
     FVector2D ScreenLocation;
-    if (UGameplayStatics::ProjectWorldToScreen(GetWorld()->GetFirstPlayerController(), OwnerLocation, ScreenLocation))
+    if (ProjectToScreen(OwnerLocation, ScreenLocation))
     {
-        FVector2D ViewportSize;
-        GetWorld()->GetGameViewport()->GetViewportSize(ViewportSize);
+        const FVector2D ViewportSize = GetViewCache().ViewportSize;
         
         // 화면 중앙에서의 거리 계산
         FVector2D CenterOffset = ScreenLocation - (ViewportSize * 0.5f);
@@ -390,109 +323,224 @@ void UCameraLockOnComponent::RestoreOriginalCameraSettings()
 
 void UCameraLockOnComponent::SwitchTarget(const FVector2D& InputDirection)
 {
-    if (!IsLockedOn() || !OwnerPawn || !Camera || PotentialTargets.Num() <= 1)
+    if (!IsLockedOn() || !OwnerPawn || !Camera || !CurrentTarget || InputDirection.X == 0.0f)
+    {
+        return;
+    }
+
+    // 화면 X 순으로 정렬된 최신 후보 목록
+    FindPotentialTargets();
+    if (PotentialTargets.Num() == 0)
     {
         return;
     }
 
-    // 현재 타겟의 인덱스 찾기
-    int32 CurrentIndex = PotentialTargets.Find(CurrentTarget);
-    if (CurrentIndex == INDEX_NONE)
+    FVector2D CurrentScreenLocation;
+    if (!ProjectToScreen(CurrentTarget->GetActorLocation(), CurrentScreenLocation))
     {
         return;
     }
 
-    // 입력 방향에 따라 다음 타겟 선택
-    int32 NextIndex = CurrentIndex;
+    // 입력 방향으로 현재 타겟 바로 옆의 후보 선택 (끝이면 반대쪽 끝으로)
+    AActor* NextTarget = nullptr;
     if (InputDirection.X > 0.0f) // 오른쪽
     {
-        NextIndex = (CurrentIndex + 1) % PotentialTargets.Num();
+        for (int32 Index = 0; Index < PotentialTargets.Num(); ++Index)
+        {
+            if (PotentialTargets[Index] != CurrentTarget && PotentialTargetScreenX[Index] > CurrentScreenLocation.X)
+            {
+                NextTarget = PotentialTargets[Index];
+                break;
+            }
+        }
+        if (!NextTarget)
+        {
+            NextTarget = PotentialTargets[0];
+        }
     }
-    else if (InputDirection.X < 0.0f) // 왼쪽
+    else // 왼쪽
     {
-        NextIndex = (CurrentIndex - 1 + PotentialTargets.Num()) % PotentialTargets.Num();
+        for (int32 Index = PotentialTargets.Num() - 1; Index >= 0; --Index)
+        {
+            if (PotentialTargets[Index] != CurrentTarget && PotentialTargetScreenX[Index] < CurrentScreenLocation.X)
+            {
+                NextTarget = PotentialTargets[Index];
+                break;
+            }
+        }
+        if (!NextTarget)
+        {
+            NextTarget = PotentialTargets.Last();
+        }
     }
 
     // 새 타겟 설정
-    if (NextIndex != CurrentIndex)
+    if (NextTarget && NextTarget != CurrentTarget)
     {
-        CurrentTarget = PotentialTargets[NextIndex];
+        CurrentTarget = NextTarget;
+        ResetOcclusionCache();
         OnLockOnTargetChanged.Broadcast(CurrentTarget);
     }
 }
 
 void UCameraLockOnComponent::FindPotentialTargets()
 {
+    LOGIC_COMBAT_SCOPE(STAT_LogicLockOnSearch);
+
+    PotentialTargets.Reset();
+    PotentialTargetScores.Reset();
+    PotentialTargetScreenX.Reset();
+
     if (!OwnerPawn || !Camera)
     {
         return;
     }
 
-    PotentialTargets.Empty();
+    UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
+    if (!Registry)
+    {
+        return;
+    }
 
-    // BaseEnemy 클래스의 액터만 검색
-    TArray<AActor*> FoundActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABaseEnemy::StaticClass(), FoundActors);
+    // 레지스트리 그리드에서 반경 안의 적만 가져오고, 시야각과 점수는 한 번에 계산
+    CandidateEnemies.Reset();
+    Registry->QueryRadius(OwnerPawn->GetActorLocation(), LockOnRadius, CandidateEnemies);
+    if (CandidateEnemies.Num() == 0)
+    {
+        return;
+    }
 
-    FVector OwnerLocation = OwnerPawn->GetActorLocation();
-    FVector CameraForward = Camera->GetForwardVector();
+    INC_DWORD_STAT_BY(STAT_LogicNumLockOnCandidates, CandidateEnemies.Num());
+    ScoreCandidates(Camera->GetForwardVector());
 
-    for (AActor* Actor : FoundActors)
+    struct FScreenCandidate
     {
-        // BaseEnemy로 캐스팅 확인
-        ABaseEnemy* Enemy = Cast<ABaseEnemy>(Actor);
-        if (!Enemy || Actor == OwnerPawn || !IsValidTarget(Enemy))
+        AActor* Target;
+        float Score;
+        float ScreenX;
+    };
+    TArray<FScreenCandidate, TInlineAllocator<16>> Sorted;
+
+    for (int32 Index = 0; Index < CandidateEnemies.Num(); ++Index)
+    {
+        ABaseEnemy* Enemy = CandidateEnemies[Index];
+        // 레지스트리가 이미 ABaseEnemy*를 주므로 후보마다 Cast하지 않고 바로 검사
+        if (CandidateScores[Index] < 0.0f || Enemy == OwnerPawn || !Enemy->IsAlive() || Enemy->IsInPool())
         {
             continue;
         }
 
-        FVector DirectionToTarget = (Enemy->GetActorLocation() - OwnerLocation).GetSafeNormal();
-        float DotProduct = FVector::DotProduct(CameraForward, DirectionToTarget);
-        float Angle = FMath::Acos(DotProduct) * (180.0f / PI);
-
-        if (Angle <= LockOnAngle)
+        // 화면에 투영되지 않는 후보도 버리지 않고 카메라 기준 좌우에 따라 목록 양 끝에 둠
+        float ScreenX;
+        FVector2D ScreenLocation;
+        if (ProjectToScreen(Enemy->GetActorLocation(), ScreenLocation))
         {
-            float Distance = FVector::Distance(OwnerLocation, Enemy->GetActorLocation());
-            if (Distance <= LockOnRadius)
-            {
-                PotentialTargets.Add(Enemy);
-            }
+            ScreenX = (float)ScreenLocation.X;
         }
+        else
+        {
+            const float Side = FVector::DotProduct(Camera->GetRightVector(), Enemy->GetActorLocation() - Camera->GetComponentLocation());
+            ScreenX = Side < 0.0f ? -TNumericLimits<float>::Max() : TNumericLimits<float>::Max();
+        }
+
+        Sorted.Add({ Enemy, CandidateScores[Index], ScreenX });
+    }
+
+    Sorted.Sort([](const FScreenCandidate& A, const FScreenCandidate& B)
+    {
+        return A.ScreenX < B.ScreenX;
+    });
+
+    for (const FScreenCandidate& Candidate : Sorted)
+    {
+        PotentialTargets.Add(Candidate.Target);
+        PotentialTargetScores.Add(Candidate.Score);
+        PotentialTargetScreenX.Add(Candidate.ScreenX);
     }
 }
 
-AActor* UCameraLockOnComponent::FindBestTarget()
+void UCameraLockOnComponent::ScoreCandidates(const FVector& CameraForward)
 {
-    if (PotentialTargets.Num() == 0)
+    LOGIC_COMBAT_SCOPE(STAT_LogicLockOnScore);
+
+    const int32 NumCandidates = CandidateEnemies.Num();
+    const int32 PaddedNum = Align(NumCandidates, 4);
+
+    CandidateX.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+    CandidateY.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+    CandidateZ.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+    CandidateScores.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+
+    // 플레이어 기준 상대 좌표로 모음 (월드 좌표가 커도 float 정밀도 유지)
+    const FVector OwnerLocation = OwnerPawn->GetActorLocation();
+    for (int32 Index = 0; Index < NumCandidates; ++Index)
+    {
+        const FVector Offset = CandidateEnemies[Index]->GetActorLocation() - OwnerLocation;
+        CandidateX[Index] = (float)Offset.X;
+        CandidateY[Index] = (float)Offset.Y;
+        CandidateZ[Index] = (float)Offset.Z;
+    }
+    for (int32 Index = NumCandidates; Index < PaddedNum; ++Index)
+    {
+        CandidateX[Index] = 0.0f;
+        CandidateY[Index] = 0.0f;
+        CandidateZ[Index] = 0.0f;
+    }
+
+    const VectorRegister4Float ForwardX = VectorSetFloat1((float)CameraForward.X);
+    const VectorRegister4Float ForwardY = VectorSetFloat1((float)CameraForward.Y);
+    const VectorRegister4Float ForwardZ = VectorSetFloat1((float)CameraForward.Z);
+    const VectorRegister4Float CosLockOnAngle = VectorSetFloat1(FMath::Cos(FMath::DegreesToRadians(LockOnAngle)));
+    const VectorRegister4Float RadiusSquared = VectorSetFloat1(FMath::Square(LockOnRadius));
+    const VectorRegister4Float InvRadius = VectorSetFloat1(1.0f / FMath::Max(LockOnRadius, 1.0f));
+    const VectorRegister4Float MinDistance = VectorSetFloat1(KINDA_SMALL_NUMBER);
+    const VectorRegister4Float DistanceWeight = VectorSetFloat1(0.4f);
+    const VectorRegister4Float DirectionWeight = VectorSetFloat1(0.6f * 0.5f);
+    const VectorRegister4Float Rejected = VectorSetFloat1(-1.0f);
+
+    for (int32 Index = 0; Index < PaddedNum; Index += 4)
     {
-        return nullptr;
+        const VectorRegister4Float DX = VectorLoad(&CandidateX[Index]);
+        const VectorRegister4Float DY = VectorLoad(&CandidateY[Index]);
+        const VectorRegister4Float DZ = VectorLoad(&CandidateZ[Index]);
+
+        VectorRegister4Float DistanceSquared = VectorMultiply(DX, DX);
+        DistanceSquared = VectorMultiplyAdd(DY, DY, DistanceSquared);
+        DistanceSquared = VectorMultiplyAdd(DZ, DZ, DistanceSquared);
+
+        VectorRegister4Float Dot = VectorMultiply(DX, ForwardX);
+        Dot = VectorMultiplyAdd(DY, ForwardY, Dot);
+        Dot = VectorMultiplyAdd(DZ, ForwardZ, Dot);
+
+        const VectorRegister4Float Distance = VectorMax(VectorSqrt(DistanceSquared), MinDistance);
+        const VectorRegister4Float CosToTarget = VectorDivide(Dot, Distance);
+
+        // 시야각: cos 비교, 반경: 거리 제곱 비교
+        const VectorRegister4Float Accepted = VectorBitwiseAnd(
+            VectorCompareGE(CosToTarget, CosLockOnAngle),
+            VectorCompareLE(DistanceSquared, RadiusSquared));
+
+        // 가까울수록 (0.4), 정면일수록 (0.6) 높은 점수
+        const VectorRegister4Float DistanceScore = VectorSubtract(VectorOne(), VectorMultiply(Distance, InvRadius));
+        const VectorRegister4Float DirectionScore = VectorAdd(CosToTarget, VectorOne());
+        const VectorRegister4Float Score = VectorMultiplyAdd(DirectionScore, DirectionWeight, VectorMultiply(DistanceScore, DistanceWeight));
+
+        VectorStore(VectorSelect(Accepted, Score, Rejected), &CandidateScores[Index]);
     }
+}
 
+AActor* UCameraLockOnComponent::FindBestTarget()
+{
     AActor* BestTarget = nullptr;
     float BestScore = -1.0f;
 
-    FVector OwnerLocation = OwnerPawn->GetActorLocation();
-    FVector CameraForward = Camera->GetForwardVector();
-
-    for (AActor* Target : PotentialTargets)
+    // 점수는 FindPotentialTargets에서 이미 계산됨
+    for (int32 Index = 0; Index < PotentialTargets.Num(); ++Index)
     {
-        FVector DirectionToTarget = (Target->GetActorLocation() - OwnerLocation).GetSafeNormal();
-        float DotProduct = FVector::DotProduct(CameraForward, DirectionToTarget);
-        float Distance = FVector::Distance(OwnerLocation, Target->GetActorLocation());
-        
-        // 거리에 따른 가중치 계산 (가까울수록 높은 점수)
-        float DistanceScore = 1.0f - (Distance / LockOnRadius);
-        
-        // 방향에 따른 가중치 계산 (정면에 있을수록 높은 점수)
-        float DirectionScore = (DotProduct + 1.0f) * 0.5f;
-        
-        // 최종 점수 계산
-        float FinalScore = (DistanceScore * 0.4f) + (DirectionScore * 0.6f);
-
-        if (FinalScore > BestScore)
+        if (PotentialTargetScores[Index] > BestScore)
         {
-            BestScore = FinalScore;
-            BestTarget = Target;
+            BestScore = PotentialTargetScores[Index];
+            BestTarget = PotentialTargets[Index];
         }
     }
 
@@ -513,8 +561,8 @@ bool UCameraLockOnComponent::IsValidTarget(AActor* Target) const
         return false;
     }
 
-    // 적이 살아있는지 확인
-    return Enemy->IsAlive();
+    // 적이 살아있고 풀에 반납된 상태가 아닌지 확인
+    return Enemy->IsAlive() && !Enemy->IsInPool();
 }
 
 bool UCameraLockOnComponent::IsTargetInRange(AActor* Target) const
@@ -527,10 +575,9 @@ bool UCameraLockOnComponent::IsTargetInRange(AActor* Target) const
     FVector Forward = OwnerPawn->GetActorForwardVector();
     FVector ToTarget = (TargetLoc - OwnerLoc).GetSafeNormal();
 
-    float Angle = FMath::RadiansToDegrees(acosf(FVector::DotProduct(Forward, ToTarget)));
-    float Distance = FVector::Distance(OwnerLoc, TargetLoc);
-
-    return (Angle <= LockOnAngle) && (Distance <= LockOnRadius);
+    // acos 대신 cos 값끼리 비교
+    return FVector::DotProduct(Forward, ToTarget) >= FMath::Cos(FMath::DegreesToRadians(LockOnAngle))
+        && FVector::DistSquared(OwnerLoc, TargetLoc) <= FMath::Square(LockOnRadius);
 }
 
 bool UCameraLockOnComponent::IsTargetInView(AActor* Target) const
@@ -541,12 +588,11 @@ bool UCameraLockOnComponent::IsTargetInView(AActor* Target) const
     }
 
     FVector2D ScreenLocation;
-    if (UGameplayStatics::ProjectWorldToScreen(GetWorld()->GetFirstPlayerController(), Target->GetActorLocation(), ScreenLocation))
+    if (ProjectToScreen(Target->GetActorLocation(), ScreenLocation))
     {
-        FVector2D ViewportSize;
-        GetWorld()->GetGameViewport()->GetViewportSize(ViewportSize);
+        const FVector2D ViewportSize = GetViewCache().ViewportSize;
         
-        // 화면 경계를 벗어났는지 확인
+        // 화면 경계를 벗어났는지 확인 (캐시된 뷰 투영 기준 = 뷰 프러스텀 안쪽)
         return ScreenLocation.X >= 0 && ScreenLocation.X <= ViewportSize.X &&
                ScreenLocation.Y >= 0 && ScreenLocation.Y <= ViewportSize.Y;
     }
@@ -556,6 +602,8 @@ bool UCameraLockOnComponent::IsTargetInView(AActor* Target) const
 
 void UCameraLockOnComponent::UpdateCameraLockOn(float DeltaTime)
 {
+    LOGIC_COMBAT_SCOPE(STAT_LogicLockOnUpdate);
+
     if (!SpringArm || !CurrentTarget || !OwnerPawn || !Camera) return;
 
     FVector OwnerPos = OwnerPawn->GetActorLocation();
@@ -592,27 +640,23 @@ void UCameraLockOnComponent::UpdateCameraLockOn(float DeltaTime)
     // 8. 컨트롤러 회전 설정
     OwnerPawn->GetController()->SetControlRotation(NewRot);
 
-    // 9. 충돌 처리
-    FHitResult HitResult;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(OwnerPawn);
-    QueryParams.AddIgnoredActor(CurrentTarget);
-
+    // 9. 충돌 처리 (비동기 트레이스 요청, 가장 최근에 완료된 결과 사용)
     FVector Start = CenterPoint;
     FVector End = CenterPoint + (LookDir * NewLength);
+    RequestOcclusionTrace(Start, End);
 
-    if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams))
+    const FOcclusionResult& Occlusion = OcclusionResults[OcclusionReadIndex];
+    if (Occlusion.bValid && Occlusion.bHit)
     {
-        float SafeDistance = HitResult.Distance * 0.8f;
+        float SafeDistance = Occlusion.HitDistance * 0.8f;
         SpringArm->TargetArmLength = FMath::Min(NewLength, SafeDistance);
     }
 
     // 10. 뷰포트 내 타겟 위치 확인 및 조정
     FVector2D ScreenLocation;
-    if (UGameplayStatics::ProjectWorldToScreen(GetWorld()->GetFirstPlayerController(), TargetPos, ScreenLocation))
+    if (ProjectToScreen(TargetPos, ScreenLocation))
     {
-        FVector2D ViewportSize;
-        GetWorld()->GetGameViewport()->GetViewportSize(ViewportSize);
+        const FVector2D ViewportSize = GetViewCache().ViewportSize;
         
         // 화면 중앙에서의 거리 계산
         FVector2D CenterOffset = ScreenLocation - (ViewportSize * 0.5f);
@@ -629,6 +673,44 @@ void UCameraLockOnComponent::UpdateCameraLockOn(float DeltaTime)
     }
 }
 
+#if LOGIC_WITH_DEBUG_OVERLAY
+void UCameraLockOnComponent::DrawDebugOverlay(bool bCombatCameraActive, bool bMoveCameraActive) const
+{
+    if (!GEngine)
+    {
+        return;
+    }
+
+    // 카메라 상태 디버그 메시지
+    GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::White, FString::Printf(TEXT("Camera State - Combat: %s, Move: %s"),
+        bCombatCameraActive ? TEXT("Active") : TEXT("Inactive"),
+        bMoveCameraActive ? TEXT("Active") : TEXT("Inactive")));
+
+    // 현재 활성화된 카메라 표시
+    if (bCombatCameraActive)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Red, TEXT("Current Camera: Combat Camera"));
+    }
+    else if (bMoveCameraActive)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Green, TEXT("Current Camera: Movement Camera"));
+    }
+
+    // 현재 타겟 정보 표시
+    if (CurrentTarget)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, FString::Printf(TEXT("Current Target: %s (Enemy)"), *CurrentTarget->GetName()));
+    }
+    else if (CurrentLockOnState == ELockOnState::Searching)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, TEXT("Searching for enemy target..."));
+    }
+    else
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, TEXT("No target"));
+    }
+}
+
 void UCameraLockOnComponent::DrawDebugInfo()
 {
     if (!OwnerPawn || !CurrentTarget) return;
@@ -651,3 +733,125 @@ void UCameraLockOnComponent::DrawDebugInfo()
     DrawDebugLine(GetWorld(), OwnerPawn->GetActorLocation(), OwnerPawn->GetActorLocation() + LeftDir * LockOnRadius, FColor::Blue, false, -1.0f, 0, 2.0f);
     DrawDebugLine(GetWorld(), OwnerPawn->GetActorLocation(), OwnerPawn->GetActorLocation() + RightDir * LockOnRadius, FColor::Blue, false, -1.0f, 0, 2.0f);
 }
+#endif
+
+const UCameraLockOnComponent::FViewCache& UCameraLockOnComponent::GetViewCache() const
+{
+    // 같은 프레임 안에서는 뷰 투영 행렬과 뷰포트 크기를 한 번만 계산
+    if (ViewCache.FrameNumber == GFrameCounter)
+    {
+        return ViewCache;
+    }
+
+    ViewCache.FrameNumber = GFrameCounter;
+    ViewCache.bValid = false;
+
+    const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+    const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+    if (!LocalPlayer || !LocalPlayer->ViewportClient || !LocalPlayer->ViewportClient->Viewport)
+    {
+        return ViewCache;
+    }
+
+    FSceneViewProjectionData ProjectionData;
+    if (LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+    {
+        ViewCache.ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+        ViewCache.ViewRect = ProjectionData.GetConstrainedViewRect();
+        LocalPlayer->ViewportClient->GetViewportSize(ViewCache.ViewportSize);
+        ViewCache.bValid = true;
+    }
+
+    return ViewCache;
+}
+
+bool UCameraLockOnComponent::ProjectToScreen(const FVector& WorldLocation, FVector2D& OutScreenLocation) const
+{
+    const FViewCache& Cache = GetViewCache();
+    if (!Cache.bValid)
+    {
+        return false;
+    }
+
+    if (!FSceneView::ProjectWorldToScreen(WorldLocation, Cache.ViewRect, Cache.ViewProjectionMatrix, OutScreenLocation))
+    {
+        return false;
+    }
+
+    // UGameplayStatics::ProjectWorldToScreen과 같이 뷰포트 기준 좌표로 변환
+    OutScreenLocation -= FVector2D(Cache.ViewRect.Min);
+    return true;
+}
+
+void UCameraLockOnComponent::RequestOcclusionTrace(const FVector& Start, const FVector& End)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // 이전 요청이 아직 진행 중이면 겹쳐서 요청하지 않음
+    if (World->IsTraceHandleValid(OcclusionTraceHandle, false))
+    {
+        return;
+    }
+
+    // 타겟이 같고 카메라/타겟이 거의 움직이지 않았으면 이전 결과 재사용
+    const float ToleranceSquared = FMath::Square(OcclusionRetraceDistance);
+    if (OcclusionTraceTarget == CurrentTarget
+        && OcclusionResults[OcclusionReadIndex].bValid
+        && FVector::DistSquared(Start, LastOcclusionTraceStart) <= ToleranceSquared
+        && FVector::DistSquared(End, LastOcclusionTraceEnd) <= ToleranceSquared)
+    {
+        return;
+    }
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(LockOnCameraOcclusion), false);
+    QueryParams.AddIgnoredActor(OwnerPawn);
+    QueryParams.AddIgnoredActor(CurrentTarget);
+
+    OcclusionTraceHandle = World->AsyncLineTraceByChannel(
+        EAsyncTraceType::Single,
+        Start,
+        End,
+        ECC_Visibility,
+        QueryParams,
+        FCollisionResponseParams::DefaultResponseParam,
+        &OcclusionTraceDelegate);
+
+    OcclusionTraceTarget = CurrentTarget;
+    LastOcclusionTraceStart = Start;
+    LastOcclusionTraceEnd = End;
+}
+
+void UCameraLockOnComponent::OnOcclusionTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+    if (Handle != OcclusionTraceHandle)
+    {
+        return;
+    }
+    OcclusionTraceHandle = FTraceHandle();
+
+    // 요청 이후 타겟이 바뀌었으면 버림
+    if (OcclusionTraceTarget != CurrentTarget)
+    {
+        return;
+    }
+
+    // 읽지 않는 쪽 버퍼에 쓰고 나서 교체
+    const int32 WriteIndex = 1 - OcclusionReadIndex;
+    FOcclusionResult& Result = OcclusionResults[WriteIndex];
+    Result.bValid = true;
+    Result.bHit = Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit;
+    Result.HitDistance = Result.bHit ? Datum.OutHits[0].Distance : 0.0f;
+
+    OcclusionReadIndex = WriteIndex;
+}
+
+void UCameraLockOnComponent::ResetOcclusionCache()
+{
+    OcclusionResults[0] = FOcclusionResult();
+    OcclusionResults[1] = FOcclusionResult();
+    OcclusionTraceTarget = nullptr;
+}
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "WorldCollision.h"
 #include "CameraLockOnComponent.generated.h"
 
 // 열거형을 먼저 선언
@@ -98,10 +99,17 @@ public:
     UPROPERTY(EditAnywhere, Category = "Camera|Distance", meta = (ClampMin = "500.0", ClampMax = "2000.0"))
     float MaxLockOnDistance = 1000.0f;
 
-    // 디버그 설정
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Debug")
+    // 카메라 충돌 트레이스 시작/끝점이 이 거리 이상 움직였을 때만 다시 트레이스
+    UPROPERTY(EditAnywhere, Category = "Camera|Collision", meta = (ClampMin = "0.0"))
+    float OcclusionRetraceDistance = 5.0f;
+
+    // 디버그 설정 (런타임에 바꿀 때는 SetShowDebugInfo로 Tick도 함께 갱신)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetShowDebugInfo, Category = "Camera|Debug")
     bool bShowDebugInfo = false;
 
+    UFUNCTION(BlueprintSetter)
+    void SetShowDebugInfo(bool bInShowDebugInfo);
+
     // 이벤트
     UPROPERTY(BlueprintAssignable, Category = "Camera|Events")
     FOnLockOnTargetChanged OnLockOnTargetChanged;
@@ -131,13 +139,63 @@ protected:
     UPROPERTY()
     AActor* CurrentTarget;
 
+    // 락온 후보 (화면 왼쪽부터 오른쪽 순으로 정렬, SwitchTarget이 그대로 사용)
     UPROPERTY()
     TArray<AActor*> PotentialTargets;
 
+    // PotentialTargets와 같은 순서의 점수 / 화면 X 좌표
+    TArray<float> PotentialTargetScores;
+    TArray<float> PotentialTargetScreenX;
+
+    // 후보 필터링/점수 계산용 SoA 버퍼 (Owner 기준 상대 좌표, SIMD 4개 단위로 패딩)
+    TArray<ABaseEnemy*> CandidateEnemies;
+    TArray<float> CandidateX;
+    TArray<float> CandidateY;
+    TArray<float> CandidateZ;
+    TArray<float> CandidateScores;
+
     float SearchTimer;
     float TimeOutOfView;
+    // 락온 해제 후 이동 카메라가 플레이어를 화면 중앙으로 되돌리는 중인지
+    bool bRecentering = false;
+
+    // 프레임당 한 번 계산하는 뷰 투영 캐시
+    struct FViewCache
+    {
+        uint64 FrameNumber = MAX_uint64;
+        bool bValid = false;
+        FMatrix ViewProjectionMatrix = FMatrix::Identity;
+        FIntRect ViewRect;
+        FVector2D ViewportSize = FVector2D::ZeroVector;
+    };
+    mutable FViewCache ViewCache;
+
+    // 비동기 충돌 트레이스 결과 (더블 버퍼: 완료된 결과를 읽는 동안 다음 결과를 받음)
+    struct FOcclusionResult
+    {
+        bool bValid = false;
+        bool bHit = false;
+        float HitDistance = 0.0f;
+    };
+    FOcclusionResult OcclusionResults[2];
+    int32 OcclusionReadIndex = 0;
+
+    FTraceHandle OcclusionTraceHandle;
+    FTraceDelegate OcclusionTraceDelegate;
+    TWeakObjectPtr<AActor> OcclusionTraceTarget;
+    FVector LastOcclusionTraceStart = FVector::ZeroVector;
+    FVector LastOcclusionTraceEnd = FVector::ZeroVector;
+
+    // 상태 전환 (카메라 모드와 Tick 활성화를 함께 갱신)
+    void SetLockOnState(ELockOnState NewState);
+    void EndLockOn();
+    void CacheCameraComponents();
+    void ApplyCameraMode(bool bCombat);
+    void UpdateTickEnabled();
+    bool UpdateRecenter(float DeltaTime);
 
     void FindPotentialTargets();
+    void ScoreCandidates(const FVector& CameraForward);
     AActor* FindBestTarget();
     bool IsValidTarget(AActor* Target) const;
     bool IsTargetInRange(AActor* Target) const;
@@ -145,4 +203,13 @@ protected:
     void UpdateCameraLockOn(float DeltaTime);
     void RestoreOriginalCameraSettings();
     void DrawDebugInfo();
+    void DrawDebugOverlay(bool bCombatCameraActive, bool bMoveCameraActive) const;
+
+    // 캐시된 뷰 투영으로 화면 좌표 계산 (뷰포트 기준 픽셀)
+    const FViewCache& GetViewCache() const;
+    bool ProjectToScreen(const FVector& WorldLocation, FVector2D& OutScreenLocation) const;
+
+    void RequestOcclusionTrace(const FVector& Start, const FVector& End);
+    void OnOcclusionTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+    void ResetOcclusionCache();
 };
@@ -0,0 +1,200 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CombatEventSubsystem.h"
+#include "LogicStats.h"
+#include "Engine/World.h"
+
+UCombatEventSubsystem* UCombatEventSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UCombatEventSubsystem>() : nullptr;
+}
+
+bool UCombatEventSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatEventSubsystem::Deinitialize()
+{
+	PendingDamage.Empty();
+	PendingDamageIndices.Empty();
+	PendingStateChanges.Empty();
+	PendingStateIndices.Empty();
+	PendingDeaths.Empty();
+	Records.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UCombatEventSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatEventSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatEventSubsystem::QueueDamage(ABaseEnemy* Target, float DamageAmount, AActor* DamageDealer)
+{
+	if (!Target)
+	{
+		return;
+	}
+
+	// 같은 대상의 타격은 합산 (타겟 설정에는 마지막으로 때린 액터 사용)
+	if (const int32* Index = PendingDamageIndices.Find(Target))
+	{
+		FPendingDamage& Pending = PendingDamage[*Index];
+		Pending.TotalDamage += DamageAmount;
+		++Pending.NumHits;
+		if (DamageDealer)
+		{
+			Pending.DamageDealer = DamageDealer;
+		}
+		return;
+	}
+
+	FPendingDamage& Pending = PendingDamage.AddDefaulted_GetRef();
+	Pending.Target = Target;
+	Pending.DamageDealer = DamageDealer;
+	Pending.TotalDamage = DamageAmount;
+	Pending.NumHits = 1;
+	PendingDamageIndices.Add(Target, PendingDamage.Num() - 1);
+}
+
+void UCombatEventSubsystem::CancelPendingDamage(const ABaseEnemy* Target)
+{
+	// 배열 순서는 그대로 두고 대상만 비움 (Flush에서 건너뜀)
+	int32 Index = INDEX_NONE;
+	if (PendingDamageIndices.RemoveAndCopyValue(Target, Index))
+	{
+		PendingDamage[Index].Target.Reset();
+	}
+}
+
+void UCombatEventSubsystem::QueueStateChange(ABaseEnemy* Enemy, EEnemyState OldState, EEnemyState NewState)
+{
+	if (!Enemy)
+	{
+		return;
+	}
+
+	// 프레임 안의 중간 상태는 건너뛰고 처음 상태 -> 마지막 상태만 남긴다
+	if (const int32* Index = PendingStateIndices.Find(Enemy))
+	{
+		PendingStateChanges[*Index].NewState = NewState;
+		return;
+	}
+
+	FPendingStateChange& Pending = PendingStateChanges.AddDefaulted_GetRef();
+	Pending.Enemy = Enemy;
+	Pending.OldState = OldState;
+	Pending.NewState = NewState;
+	PendingStateIndices.Add(Enemy, PendingStateChanges.Num() - 1);
+}
+
+void UCombatEventSubsystem::QueueDeath(ABaseEnemy* Enemy)
+{
+	if (Enemy)
+	{
+		PendingDeaths.Add(Enemy);
+	}
+}
+
+void UCombatEventSubsystem::Tick(float DeltaTime)
+{
+	if (PendingDamage.Num() > 0 || PendingStateChanges.Num() > 0 || PendingDeaths.Num() > 0)
+	{
+		Flush();
+	}
+}
+
+void UCombatEventSubsystem::Flush()
+{
+	if (bFlushing)
+	{
+		return;
+	}
+	TGuardValue<bool> FlushingGuard(bFlushing, true);
+
+	LOGIC_COMBAT_SCOPE(STAT_LogicCombatEventFlush);
+
+	Records.Reset();
+
+	// 1. 데미지 적용 (사망 처리로 생기는 상태 변경은 아래에서 같이 전달됨)
+	Swap(ApplyingDamage, PendingDamage);
+	PendingDamageIndices.Reset();
+
+	for (const FPendingDamage& Pending : ApplyingDamage)
+	{
+		ABaseEnemy* Target = Pending.Target.Get();
+		if (Target && Target->ApplyCoalescedDamage(Pending.TotalDamage, Pending.DamageDealer.Get()))
+		{
+			FCombatEventRecord& Record = Records.AddDefaulted_GetRef();
+			Record.Type = ECombatEventType::Damage;
+			Record.Enemy = Target;
+			Record.Damage = Pending.TotalDamage;
+			Record.NumHits = Pending.NumHits;
+		}
+	}
+	ApplyingDamage.Reset();
+
+	// 2. 상태 변경 수집 (결국 원래 상태로 돌아왔으면 알리지 않음)
+	Swap(ApplyingStateChanges, PendingStateChanges);
+	PendingStateIndices.Reset();
+
+	for (const FPendingStateChange& Pending : ApplyingStateChanges)
+	{
+		ABaseEnemy* Enemy = Pending.Enemy.Get();
+		if (Enemy && Pending.OldState != Pending.NewState)
+		{
+			FCombatEventRecord& Record = Records.AddDefaulted_GetRef();
+			Record.Type = ECombatEventType::StateChanged;
+			Record.Enemy = Enemy;
+			Record.NewState = Pending.NewState;
+		}
+	}
+	ApplyingStateChanges.Reset();
+
+	// 3. 사망 (위 데미지로 죽은 적 포함, 피격/상태 변경 알림 뒤에 전달)
+	Swap(ApplyingDeaths, PendingDeaths);
+	for (const TWeakObjectPtr<ABaseEnemy>& Enemy : ApplyingDeaths)
+	{
+		if (Enemy.IsValid())
+		{
+			FCombatEventRecord& Record = Records.AddDefaulted_GetRef();
+			Record.Type = ECombatEventType::Death;
+			Record.Enemy = Enemy.Get();
+		}
+	}
+	ApplyingDeaths.Reset();
+
+	if (Records.Num() == 0)
+	{
+		return;
+	}
+
+	// 4. 적별 델리게이트/블루프린트 이벤트 (리스너가 새로 요청한 것은 다음 프레임)
+	for (const FCombatEventRecord& Record : Records)
+	{
+		if (!IsValid(Record.Enemy))
+		{
+			continue;
+		}
+
+		switch (Record.Type)
+		{
+		case ECombatEventType::Damage:
+			Record.Enemy->NotifyDamageTaken(Record.Damage);
+			break;
+		case ECombatEventType::StateChanged:
+			Record.Enemy->NotifyStateChanged(Record.NewState);
+			break;
+		case ECombatEventType::Death:
+			Record.Enemy->NotifyDeath();
+			break;
+		}
+	}
+
+	// 5. UI/오디오 등 일괄 리스너
+	OnCombatEventsFlushedNative.Broadcast(Records);
+	OnCombatEventsFlushed.Broadcast(Records);
+}
@@ -0,0 +1,119 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BaseEnemy.h"
+#include "CombatEventSubsystem.generated.h"
+
+UENUM(BlueprintType)
+enum class ECombatEventType : uint8
+{
+	Damage          UMETA(DisplayName = "Damage"),
+	StateChanged    UMETA(DisplayName = "State Changed"),
+	Death           UMETA(DisplayName = "Death")
+};
+
+// 한 프레임 동안 모인 전투 알림 한 건 (같은 적의 타격/상태 변경은 하나로 합쳐짐)
+USTRUCT(BlueprintType)
+struct FCombatEventRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat Event")
+	ECombatEventType Type = ECombatEventType::Damage;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat Event")
+	TObjectPtr<ABaseEnemy> Enemy;
+
+	// Damage: 이번 프레임 합산 데미지와 타격 수
+	UPROPERTY(BlueprintReadOnly, Category = "Combat Event")
+	float Damage = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Combat Event")
+	int32 NumHits = 0;
+
+	// StateChanged: 이번 프레임 마지막 상태
+	UPROPERTY(BlueprintReadOnly, Category = "Combat Event")
+	EEnemyState NewState = EEnemyState::Idle;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCombatEventsFlushed, const TArray<FCombatEventRecord>&, Events);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCombatEventsFlushedNative, const TArray<FCombatEventRecord>&);
+
+/**
+ * 데미지와 상태 변경 알림을 프레임 단위로 모아 처리하는 전투 이벤트 버스
+ * 같은 대상에 대한 타격은 합산해서 한 번에 적용하고 (범위 공격이 군중에 맞아도 적당 1회),
+ * 적별 델리게이트/블루프린트 이벤트와 UI/오디오용 OnCombatEventsFlushed는 프레임마다 한 지점에서만 호출한다.
+ * 사망 알림도 같은 흐름으로 모아서 적마다 피격 -> 상태 변경 -> 사망 순서로 전달한다.
+ * 처리 중 새로 들어온 타격/상태 변경은 다음 프레임으로 넘어가고, 처리 중 다시 호출된 Flush는 무시된다.
+ */
+UCLASS()
+class LOGIC_API UCombatEventSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UCombatEventSubsystem* Get(const UObject* WorldContextObject);
+
+	void QueueDamage(ABaseEnemy* Target, float DamageAmount, AActor* DamageDealer);
+	void QueueStateChange(ABaseEnemy* Enemy, EEnemyState OldState, EEnemyState NewState);
+	void QueueDeath(ABaseEnemy* Enemy);
+
+	// 아직 적용되지 않은 데미지 버림 (풀 반납/강등된 적이 다음 Flush에서 맞지 않도록)
+	void CancelPendingDamage(const ABaseEnemy* Target);
+
+	// 모인 데미지 적용 후 알림 전달 (Tick에서 호출, 즉시 처리가 필요할 때 직접 호출 가능)
+	void Flush();
+
+	// 프레임마다 한 번, 이번 프레임 알림 전체를 전달
+	UPROPERTY(BlueprintAssignable, Category = "Combat Event")
+	FOnCombatEventsFlushed OnCombatEventsFlushed;
+
+	FOnCombatEventsFlushedNative OnCombatEventsFlushedNative;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FPendingDamage
+	{
+		TWeakObjectPtr<ABaseEnemy> Target;
+		TWeakObjectPtr<AActor> DamageDealer;
+		float TotalDamage = 0.0f;
+		int32 NumHits = 0;
+	};
+
+	struct FPendingStateChange
+	{
+		TWeakObjectPtr<ABaseEnemy> Enemy;
+		EEnemyState OldState = EEnemyState::Idle;
+		EEnemyState NewState = EEnemyState::Idle;
+	};
+
+	TArray<FPendingDamage> PendingDamage;
+	TMap<const ABaseEnemy*, int32> PendingDamageIndices;
+
+	TArray<FPendingStateChange> PendingStateChanges;
+	TMap<const ABaseEnemy*, int32> PendingStateIndices;
+
+	TArray<TWeakObjectPtr<ABaseEnemy>> PendingDeaths;
+
+	// Flush 도중 들어온 요청과 섞이지 않도록 처리 중인 목록은 따로 둔다
+	TArray<FPendingDamage> ApplyingDamage;
+	TArray<FPendingStateChange> ApplyingStateChanges;
+	TArray<TWeakObjectPtr<ABaseEnemy>> ApplyingDeaths;
+
+	// 리스너가 알림 안에서 Flush를 다시 부르면 처리 중인 목록이 바뀌므로 막음
+	bool bFlushing = false;
+
+	UPROPERTY(Transient)
+	TArray<FCombatEventRecord> Records;
+};
@@ -0,0 +1,339 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CombatTimerSubsystem.h"
+#include "BaseEnemy.h"
+#include "LogicStats.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace CombatTimerWheel
+{
+	// 1단계: 256칸, 상위 3단계: 64칸씩 (60Hz 기준 약 4초 / 4.5분 / 5시간 / 12일)
+	constexpr int32 Level0Bits = 8;
+	constexpr int32 LevelBits = 6;
+	constexpr int32 NumUpperLevels = 3;
+	constexpr int32 Level0Slots = 1 << Level0Bits;
+	constexpr int32 LevelSlots = 1 << LevelBits;
+	constexpr int32 NumSlots = Level0Slots + LevelSlots * NumUpperLevels;
+
+	// 휠이 표현할 수 있는 최대 지연 (칸 수). 더 긴 지연은 여기로 잘린다.
+	constexpr uint64 MaxDelayTicks = (uint64(1) << (Level0Bits + LevelBits * NumUpperLevels)) - 1;
+
+	constexpr int32 GetLevelShift(int32 Level)
+	{
+		return Level0Bits + LevelBits * (Level - 1);
+	}
+}
+
+static FAutoConsoleCommandWithWorld GCombatTimerStatsCommand(
+	TEXT("Logic.CombatTimer.Stats"),
+	TEXT("활성 전투 타이머 수와 노드 풀 크기를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(World))
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *Timers->GetStatsString());
+		}
+	}));
+
+UCombatTimerSubsystem* UCombatTimerSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UCombatTimerSubsystem>() : nullptr;
+}
+
+bool UCombatTimerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatTimerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TickResolution = FMath::Max(TickResolution, 0.001f);
+	SlotHeads.Init(INDEX_NONE, CombatTimerWheel::NumSlots);
+}
+
+void UCombatTimerSubsystem::Deinitialize()
+{
+	Nodes.Empty();
+	FreeNodes.Empty();
+	SlotHeads.Empty();
+	FiredNodes.Empty();
+	NumActiveTimers = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UCombatTimerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatTimerSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatTimerSubsystem::SetTimer(FCombatTimerHandle& InOutHandle, ABaseEnemy* Owner, ECombatTimerEvent Event, float Delay)
+{
+	ClearTimer(InOutHandle);
+
+	if (!Owner || SlotHeads.Num() == 0)
+	{
+		return;
+	}
+
+	// 최소 한 칸 뒤에 만료 (같은 프레임에 바로 실행되지 않음)
+	const uint64 DelayTicks = FMath::Clamp<uint64>(
+		(uint64)FMath::CeilToInt64(FMath::Max(Delay, 0.0f) / TickResolution), 1, CombatTimerWheel::MaxDelayTicks);
+
+	const int32 NodeIndex = AllocateNode();
+	FNode& Node = Nodes[NodeIndex];
+	Node.Owner = Owner;
+	Node.Event = Event;
+	Node.ExpireTick = CurrentTick + DelayTicks;
+	Node.State = ENodeState::Scheduled;
+	Node.bCancelled = false;
+	LinkNode(NodeIndex);
+	++NumActiveTimers;
+
+	InOutHandle.Index = NodeIndex;
+	InOutHandle.Serial = Node.Serial;
+}
+
+void UCombatTimerSubsystem::ClearTimer(FCombatTimerHandle& InOutHandle)
+{
+	if (IsTimerActive(InOutHandle))
+	{
+		FNode& Node = Nodes[InOutHandle.Index];
+		if (Node.State == ENodeState::Scheduled)
+		{
+			UnlinkNode(InOutHandle.Index);
+			FreeNode(InOutHandle.Index);
+			--NumActiveTimers;
+		}
+		else
+		{
+			// 이미 만료되어 전달 대기 중: 전달만 막고 노드는 DispatchFired에서 반환
+			Node.bCancelled = true;
+			++Node.Serial;
+		}
+	}
+
+	InOutHandle.Invalidate();
+}
+
+bool UCombatTimerSubsystem::IsTimerActive(const FCombatTimerHandle& Handle) const
+{
+	if (!Nodes.IsValidIndex(Handle.Index))
+	{
+		return false;
+	}
+
+	const FNode& Node = Nodes[Handle.Index];
+	return Node.Serial == Handle.Serial && Node.State != ENodeState::Free && !Node.bCancelled;
+}
+
+int32 UCombatTimerSubsystem::AllocateNode()
+{
+	if (FreeNodes.Num() > 0)
+	{
+		return FreeNodes.Pop(EAllowShrinking::No);
+	}
+	return Nodes.AddDefaulted();
+}
+
+void UCombatTimerSubsystem::FreeNode(int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+	Node.Owner.Reset();
+	Node.State = ENodeState::Free;
+	Node.bCancelled = false;
+	Node.Slot = INDEX_NONE;
+	Node.Prev = INDEX_NONE;
+	Node.Next = INDEX_NONE;
+	// 이전 핸들이 재사용된 노드를 가리키지 않도록
+	++Node.Serial;
+
+	FreeNodes.Add(NodeIndex);
+}
+
+void UCombatTimerSubsystem::LinkNode(int32 NodeIndex)
+{
+	using namespace CombatTimerWheel;
+
+	FNode& Node = Nodes[NodeIndex];
+	const uint64 Expire = FMath::Max(Node.ExpireTick, CurrentTick);
+	const uint64 Delta = Expire - CurrentTick;
+
+	// 남은 시간에 맞는 휠을 고르고 그 휠의 만료 시각 비트로 칸을 정한다
+	int32 Slot = INDEX_NONE;
+	if (Delta < Level0Slots)
+	{
+		Slot = (int32)(Expire & (Level0Slots - 1));
+	}
+	else
+	{
+		for (int32 Level = 1; Level <= NumUpperLevels; ++Level)
+		{
+			const int32 Shift = GetLevelShift(Level);
+			if (Delta < (uint64(1) << (Shift + LevelBits)) || Level == NumUpperLevels)
+			{
+				Slot = Level0Slots + LevelSlots * (Level - 1) + (int32)((Expire >> Shift) & (LevelSlots - 1));
+				break;
+			}
+		}
+	}
+
+	Node.Slot = Slot;
+	Node.Prev = INDEX_NONE;
+	Node.Next = SlotHeads[Slot];
+	if (Node.Next != INDEX_NONE)
+	{
+		Nodes[Node.Next].Prev = NodeIndex;
+	}
+	SlotHeads[Slot] = NodeIndex;
+}
+
+void UCombatTimerSubsystem::UnlinkNode(int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+
+	if (Node.Prev != INDEX_NONE)
+	{
+		Nodes[Node.Prev].Next = Node.Next;
+	}
+	else
+	{
+		SlotHeads[Node.Slot] = Node.Next;
+	}
+
+	if (Node.Next != INDEX_NONE)
+	{
+		Nodes[Node.Next].Prev = Node.Prev;
+	}
+
+	Node.Slot = INDEX_NONE;
+	Node.Prev = INDEX_NONE;
+	Node.Next = INDEX_NONE;
+}
+
+int32 UCombatTimerSubsystem::Cascade(int32 Level)
+{
+	using namespace CombatTimerWheel;
+
+	const int32 Index = (int32)((CurrentTick >> GetLevelShift(Level)) & (LevelSlots - 1));
+	const int32 Slot = Level0Slots + LevelSlots * (Level - 1) + Index;
+
+	int32 NodeIndex = SlotHeads[Slot];
+	SlotHeads[Slot] = INDEX_NONE;
+
+	while (NodeIndex != INDEX_NONE)
+	{
+		const int32 Next = Nodes[NodeIndex].Next;
+		LinkNode(NodeIndex);
+		NodeIndex = Next;
+	}
+
+	return Index;
+}
+
+void UCombatTimerSubsystem::AdvanceOneTick()
+{
+	using namespace CombatTimerWheel;
+
+	++CurrentTick;
+
+	// 1단계 휠이 한 바퀴 돌았으면 상위 휠 한 칸을 내려보냄 (상위 휠도 한 바퀴 돌았으면 그 위까지)
+	const int32 Index = (int32)(CurrentTick & (Level0Slots - 1));
+	if (Index == 0)
+	{
+		for (int32 Level = 1; Level <= NumUpperLevels; ++Level)
+		{
+			if (Cascade(Level) != 0)
+			{
+				break;
+			}
+		}
+	}
+
+	int32 NodeIndex = SlotHeads[Index];
+	SlotHeads[Index] = INDEX_NONE;
+
+	while (NodeIndex != INDEX_NONE)
+	{
+		FNode& Node = Nodes[NodeIndex];
+		const int32 Next = Node.Next;
+
+		Node.State = ENodeState::Firing;
+		Node.Slot = INDEX_NONE;
+		Node.Prev = INDEX_NONE;
+		Node.Next = INDEX_NONE;
+		FiredNodes.Add(NodeIndex);
+		--NumActiveTimers;
+
+		NodeIndex = Next;
+	}
+}
+
+void UCombatTimerSubsystem::DispatchFired()
+{
+	// 콜백에서 SetTimer가 Nodes를 늘릴 수 있으므로 참조를 들고 있지 않는다
+	for (const int32 NodeIndex : FiredNodes)
+	{
+		if (Nodes[NodeIndex].bCancelled)
+		{
+			continue;
+		}
+
+		// 콜백 안에서는 이 타이머가 이미 끝난 것으로 보이게 한다
+		Nodes[NodeIndex].bCancelled = true;
+		++Nodes[NodeIndex].Serial;
+
+		const ECombatTimerEvent Event = Nodes[NodeIndex].Event;
+		if (ABaseEnemy* Owner = Nodes[NodeIndex].Owner.Get())
+		{
+			Owner->OnCombatTimer(Event);
+		}
+	}
+
+	for (const int32 NodeIndex : FiredNodes)
+	{
+		FreeNode(NodeIndex);
+	}
+	FiredNodes.Reset();
+}
+
+void UCombatTimerSubsystem::Tick(float DeltaTime)
+{
+	LOGIC_COMBAT_SCOPE(STAT_LogicCombatTimers);
+
+	TimeAccumulator += DeltaTime;
+	const int32 NumTicks = FMath::Min(FMath::FloorToInt32(TimeAccumulator / TickResolution), MaxTicksPerFrame);
+	if (NumTicks <= 0)
+	{
+		return;
+	}
+	TimeAccumulator -= NumTicks * TickResolution;
+
+	if (NumActiveTimers == 0)
+	{
+		// 휠이 비어 있으면 내려보낼 것도 없으므로 시각만 진행
+		CurrentTick += NumTicks;
+		NumFiredLastFrame = 0;
+		return;
+	}
+
+	for (int32 Step = 0; Step < NumTicks; ++Step)
+	{
+		AdvanceOneTick();
+	}
+
+	NumFiredLastFrame = FiredNodes.Num();
+	INC_DWORD_STAT_BY(STAT_LogicNumCombatTimersFired, NumFiredLastFrame);
+
+	DispatchFired();
+}
+
+FString UCombatTimerSubsystem::GetStatsString() const
+{
+	return FString::Printf(TEXT("Combat Timers - Active: %d, Nodes: %d (free %d), Fired last frame: %d, Tick: %llu"),
+		NumActiveTimers, Nodes.Num(), FreeNodes.Num(), NumFiredLastFrame, CurrentTick);
+}
@@ -0,0 +1,124 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/TimerHandle.h"
+#include "CombatTimerSubsystem.generated.h"
+
+class ABaseEnemy;
+
+// 전투 타이머 종류 (만료 시 ABaseEnemy::OnCombatTimer로 전달)
+UENUM(BlueprintType)
+enum class ECombatTimerEvent : uint8
+{
+	StunEnd                 UMETA(DisplayName = "Stun End"),
+	AttackCooldownEnd       UMETA(DisplayName = "Attack Cooldown End"),
+	LoseTarget              UMETA(DisplayName = "Lose Target"),
+	Despawn                 UMETA(DisplayName = "Despawn"),
+	JumpAttackCooldownEnd   UMETA(DisplayName = "Jump Attack Cooldown End"),
+	Bounce                  UMETA(DisplayName = "Bounce"),
+	JumpAttackTimeout       UMETA(DisplayName = "Jump Attack Timeout")
+};
+
+// 전투 타이머 핸들 (노드 인덱스 + 재사용 구분용 시리얼)
+struct FCombatTimerHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	// 서브시스템이 없는 월드에서 ABaseEnemy가 대신 쓰는 엔진 타이머
+	FTimerHandle FallbackTimer;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Invalidate() { Index = INDEX_NONE; }
+};
+
+/**
+ * 적 쿨다운/지속시간용 계층형 타이밍 휠
+ * 노드는 배열 + 프리 리스트로 재사용하고 슬롯마다 인덱스 기반 이중 연결 리스트를 둬서 설정/취소가 O(1)이다.
+ * 1단계 휠(256칸)이 한 바퀴 돌 때마다 상위 휠(64칸 x 3) 한 칸을 하위로 내려보낸다.
+ * 만료된 타이머는 프레임마다 한 번 모아서 ABaseEnemy::OnCombatTimer로 전달한다 (람다/델리게이트 할당 없음).
+ */
+UCLASS(config=Game)
+class LOGIC_API UCombatTimerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UCombatTimerSubsystem* Get(const UObject* WorldContextObject);
+
+	// InOutHandle이 활성 상태면 먼저 취소 후 다시 설정 (FTimerManager::SetTimer와 같은 의미)
+	void SetTimer(FCombatTimerHandle& InOutHandle, ABaseEnemy* Owner, ECombatTimerEvent Event, float Delay);
+	void ClearTimer(FCombatTimerHandle& InOutHandle);
+	bool IsTimerActive(const FCombatTimerHandle& Handle) const;
+
+	int32 GetNumActiveTimers() const { return NumActiveTimers; }
+
+	FString GetStatsString() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 휠 한 칸의 시간 (초). 만료 시각은 이 단위로 올림된다.
+	UPROPERTY(Config, EditAnywhere, Category = "Combat Timer")
+	float TickResolution = 1.0f / 60.0f;
+
+	// 한 프레임에 진행할 최대 칸 수 (긴 히치 뒤 몰아서 처리하는 양 제한)
+	UPROPERTY(Config, EditAnywhere, Category = "Combat Timer")
+	int32 MaxTicksPerFrame = 256;
+
+private:
+	enum class ENodeState : uint8
+	{
+		Free,
+		Scheduled,
+		// 만료되어 이번 프레임 전달 대기 중
+		Firing
+	};
+
+	struct FNode
+	{
+		TWeakObjectPtr<ABaseEnemy> Owner;
+		uint64 ExpireTick = 0;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		int32 Slot = INDEX_NONE;
+		uint32 Serial = 0;
+		ECombatTimerEvent Event = ECombatTimerEvent::StunEnd;
+		ENodeState State = ENodeState::Free;
+		bool bCancelled = false;
+	};
+
+	int32 AllocateNode();
+	void FreeNode(int32 NodeIndex);
+	void LinkNode(int32 NodeIndex);
+	void UnlinkNode(int32 NodeIndex);
+
+	// 상위 휠 한 칸의 노드를 현재 시각 기준으로 다시 배치. 해당 휠의 칸 인덱스를 반환
+	int32 Cascade(int32 Level);
+	void AdvanceOneTick();
+	void DispatchFired();
+
+	TArray<FNode> Nodes;
+	TArray<int32> FreeNodes;
+
+	// 모든 휠의 칸을 이어붙인 리스트 헤드 (1단계 256칸 + 상위 64칸 x 3)
+	TArray<int32> SlotHeads;
+
+	// 이번 프레임에 만료된 노드 (만료 순서 유지)
+	TArray<int32> FiredNodes;
+
+	uint64 CurrentTick = 0;
+	float TimeAccumulator = 0.0f;
+	int32 NumActiveTimers = 0;
+	int32 NumFiredLastFrame = 0;
+};
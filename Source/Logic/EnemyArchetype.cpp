@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyArchetype.h"
+
+namespace EnemyArchetype
+{
+	constexpr int32 NumRanks = 4;
+}
+
+void UEnemyArchetype::PostLoad()
+{
+	Super::PostLoad();
+
+	BuildStatTable();
+}
+
+#if WITH_EDITOR
+void UEnemyArchetype::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BuildStatTable();
+}
+#endif
+
+const FEnemyStatBlock& UEnemyArchetype::GetStatBlock(int32 Level, EEnemyRank Rank) const
+{
+	// 런타임에 만든 에셋은 PostLoad를 거치지 않음
+	if (StatTable.Num() == 0)
+	{
+		BuildStatTable();
+	}
+
+	// MaxLevel이 테이블을 다시 만들지 않고 바뀌었을 수 있으므로 실제 테이블 크기로 제한
+	const int32 NumLevels = StatTable.Num() / EnemyArchetype::NumRanks;
+	const int32 LevelIndex = FMath::Clamp(Level, 1, NumLevels) - 1;
+	const int32 RankIndex = FMath::Clamp((int32)Rank, 0, EnemyArchetype::NumRanks - 1);
+	return StatTable[LevelIndex * EnemyArchetype::NumRanks + RankIndex];
+}
+
+FEnemyStatBlock UEnemyArchetype::ComputeStatBlock(const FEnemyStatBlock& Base, int32 Level, EEnemyRank Rank, float InLevelScale, int32 InExperiencePerLevel)
+{
+	FEnemyStatBlock Result = Base;
+
+	// 레벨에 따른 스탯 조정
+	if (Level > 1)
+	{
+		const float LevelMultiplier = 1.0f + (Level - 1) * InLevelScale;
+		Result.MaxHealth *= LevelMultiplier;
+		Result.AttackDamage *= LevelMultiplier;
+		Result.ExperienceReward = Base.ExperienceReward + (Level - 1) * InExperiencePerLevel;
+	}
+
+	// 적 등급에 따른 스탯 조정
+	switch (Rank)
+	{
+	case EEnemyRank::Elite:
+		Result.MaxHealth *= 2.0f;
+		Result.AttackDamage *= 1.5f;
+		Result.ExperienceReward *= 2;
+		break;
+	case EEnemyRank::MiniBoss:
+		Result.MaxHealth *= 3.0f;
+		Result.AttackDamage *= 2.0f;
+		Result.ExperienceReward *= 3;
+		break;
+	case EEnemyRank::Boss:
+		Result.MaxHealth *= 5.0f;
+		Result.AttackDamage *= 3.0f;
+		Result.ExperienceReward *= 5;
+		break;
+	default:
+		break;
+	}
+
+	return Result;
+}
+
+void UEnemyArchetype::BuildStatTable() const
+{
+	const int32 NumLevels = FMath::Max(1, MaxLevel);
+	StatTable.SetNum(NumLevels * EnemyArchetype::NumRanks);
+
+	for (int32 LevelIndex = 0; LevelIndex < NumLevels; ++LevelIndex)
+	{
+		for (int32 RankIndex = 0; RankIndex < EnemyArchetype::NumRanks; ++RankIndex)
+		{
+			StatTable[LevelIndex * EnemyArchetype::NumRanks + RankIndex] =
+				ComputeStatBlock(BaseStats, LevelIndex + 1, (EEnemyRank)RankIndex, LevelScale, ExperiencePerLevel);
+		}
+	}
+}
@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "EnemyArchetype.generated.h"
+
+// 적 등급 열거형
+UENUM(BlueprintType)
+enum class EEnemyRank : uint8
+{
+	Normal      UMETA(DisplayName = "Normal"),
+	Elite       UMETA(DisplayName = "Elite"),
+	Boss        UMETA(DisplayName = "Boss"),
+	MiniBoss    UMETA(DisplayName = "MiniBoss")
+};
+
+// 레벨/등급이 적용된 최종 스탯
+USTRUCT(BlueprintType)
+struct FEnemyStatBlock
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Stats")
+	float MaxHealth = 100.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Stats")
+	float AttackDamage = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Stats")
+	float AttackRange = 200.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Stats")
+	float DetectionRange = 800.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Stats")
+	float MovementSpeed = 300.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Stats")
+	int32 ExperienceReward = 50;
+};
+
+/**
+ * 적 종류별 공유 스탯 데이터
+ * 로드 시 (레벨 x 등급) 조합의 스탯 블록을 미리 계산해 두고, 적 인스턴스는 아키타입과 레벨/등급으로 블록을 찾는다.
+ * 테이블은 에디터에서 다시 만들어질 수 있으므로 블록 포인터는 보관하지 않는다. 블루프린트와 기존 코드가 쓰는
+ * 인스턴스 스탯 필드(MaxHealth 등)는 스폰 시 블록에서 복사하므로, 같은 아키타입을 쓰는 적이 많을수록 스폰 시 계산이 줄어든다.
+ */
+UCLASS(BlueprintType)
+class LOGIC_API UEnemyArchetype : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// 레벨 1, Normal 등급 기준 스탯
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype")
+	FEnemyStatBlock BaseStats;
+
+	// 미리 계산할 최대 레벨 (넘으면 최대 레벨 스탯 사용)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype", meta = (ClampMin = "1"))
+	int32 MaxLevel = 30;
+
+	// 레벨당 체력/공격력 증가율
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype")
+	float LevelScale = 0.15f;
+
+	// 레벨당 경험치 증가량
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype")
+	int32 ExperiencePerLevel = 10;
+
+	// 미리 계산된 스탯 블록 (Level은 1부터)
+	const FEnemyStatBlock& GetStatBlock(int32 Level, EEnemyRank Rank) const;
+
+	UFUNCTION(BlueprintPure, Category = "Archetype")
+	FEnemyStatBlock GetStats(int32 Level, EEnemyRank Rank) const { return GetStatBlock(Level, Rank); }
+
+	// 기준 스탯에 레벨/등급 배율을 적용 (아키타입이 없는 적도 같은 공식 사용)
+	static FEnemyStatBlock ComputeStatBlock(const FEnemyStatBlock& Base, int32 Level, EEnemyRank Rank, float InLevelScale = 0.15f, int32 InExperiencePerLevel = 10);
+
+private:
+	void BuildStatTable() const;
+
+	// [(Level - 1) * NumRanks + Rank]
+	mutable TArray<FEnemyStatBlock> StatTable;
+};
@@ -0,0 +1,189 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyBatchUpdateSubsystem.h"
+#include "BaseEnemy.h"
+#include "Engine/World.h"
+#include "Math/VectorRegister.h"
+
+UEnemyBatchUpdateSubsystem* UEnemyBatchUpdateSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemyBatchUpdateSubsystem>() : nullptr;
+}
+
+bool UEnemyBatchUpdateSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyBatchUpdateSubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	EnemyIndices.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyBatchUpdateSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyBatchUpdateSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyBatchUpdateSubsystem::RegisterEnemy(ABaseEnemy* Enemy)
+{
+	if (!Enemy || EnemyIndices.Contains(Enemy))
+	{
+		return;
+	}
+
+	EnemyIndices.Add(Enemy, Enemies.Add(Enemy));
+
+	// 매니저가 대신 처리하므로 액터 Tick은 끈다
+	Enemy->SetActorTickEnabled(false);
+}
+
+void UEnemyBatchUpdateSubsystem::UnregisterEnemy(ABaseEnemy* Enemy, bool bRestoreActorTick)
+{
+	int32 Index = INDEX_NONE;
+	if (!EnemyIndices.RemoveAndCopyValue(Enemy, Index))
+	{
+		return;
+	}
+
+	const int32 LastIndex = Enemies.Num() - 1;
+	if (Index != LastIndex)
+	{
+		EnemyIndices.Add(Enemies[LastIndex], Index);
+	}
+	Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (bRestoreActorTick)
+	{
+		Enemy->SetActorTickEnabled(true);
+	}
+}
+
+void UEnemyBatchUpdateSubsystem::Tick(float DeltaTime)
+{
+	if (Enemies.Num() == 0)
+	{
+		return;
+	}
+
+	GatherInputs();
+	ComputeRangeMasks();
+	ApplyStateChanges();
+}
+
+void UEnemyBatchUpdateSubsystem::GatherInputs()
+{
+	const int32 Num = Enemies.Num();
+	const int32 PaddedNum = Align(Num, 4);
+
+	EnemyX.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	EnemyY.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	EnemyZ.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	TargetX.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	TargetY.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	TargetZ.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	AttackRangeSquared.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	DetectionRangeSquared.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	ActiveFlags.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	InAttackRangeFlags.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	OutOfDetectionRangeFlags.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+
+	// 큰 월드 좌표에서도 float 정밀도를 유지하기 위해 첫 적 위치를 기준점으로 사용
+	const FVector Origin = Enemies[0] ? Enemies[0]->GetActorLocation() : FVector::ZeroVector;
+
+	for (int32 Index = 0; Index < PaddedNum; ++Index)
+	{
+		const ABaseEnemy* Enemy = Index < Num ? Enemies[Index].Get() : nullptr;
+		const APawn* Target = Enemy ? Enemy->GetTarget() : nullptr;
+
+		// 기존 Tick과 같은 조건: 타겟이 있고 살아있으며 추적 중
+		const bool bEligible = Target && Enemy->IsAlive() && Enemy->GetCurrentState() == EEnemyState::Chasing;
+		ActiveFlags[Index] = bEligible ? 1 : 0;
+
+		if (!bEligible)
+		{
+			// 비활성/패딩 슬롯은 어떤 비교도 통과하지 않는 값으로 채운다
+			EnemyX[Index] = EnemyY[Index] = EnemyZ[Index] = 0.0f;
+			TargetX[Index] = TargetY[Index] = TargetZ[Index] = 0.0f;
+			AttackRangeSquared[Index] = -1.0f;
+			DetectionRangeSquared[Index] = MAX_FLT;
+			continue;
+		}
+
+		const FVector EnemyLocation = Enemy->GetActorLocation() - Origin;
+		const FVector TargetLocation = Target->GetActorLocation() - Origin;
+
+		EnemyX[Index] = static_cast<float>(EnemyLocation.X);
+		EnemyY[Index] = static_cast<float>(EnemyLocation.Y);
+		EnemyZ[Index] = static_cast<float>(EnemyLocation.Z);
+		TargetX[Index] = static_cast<float>(TargetLocation.X);
+		TargetY[Index] = static_cast<float>(TargetLocation.Y);
+		TargetZ[Index] = static_cast<float>(TargetLocation.Z);
+		AttackRangeSquared[Index] = FMath::Square(Enemy->AttackRange);
+		DetectionRangeSquared[Index] = FMath::Square(Enemy->DetectionRange);
+	}
+}
+
+void UEnemyBatchUpdateSubsystem::ComputeRangeMasks()
+{
+	const int32 PaddedNum = EnemyX.Num();
+
+	for (int32 Index = 0; Index < PaddedNum; Index += 4)
+	{
+		const VectorRegister4Float DX = VectorSubtract(VectorLoad(&EnemyX[Index]), VectorLoad(&TargetX[Index]));
+		const VectorRegister4Float DY = VectorSubtract(VectorLoad(&EnemyY[Index]), VectorLoad(&TargetY[Index]));
+		const VectorRegister4Float DZ = VectorSubtract(VectorLoad(&EnemyZ[Index]), VectorLoad(&TargetZ[Index]));
+
+		VectorRegister4Float DistanceSquared = VectorMultiply(DX, DX);
+		DistanceSquared = VectorMultiplyAdd(DY, DY, DistanceSquared);
+		DistanceSquared = VectorMultiplyAdd(DZ, DZ, DistanceSquared);
+
+		const int32 AttackMask = VectorMaskBits(VectorCompareLE(DistanceSquared, VectorLoad(&AttackRangeSquared[Index])));
+		const int32 LostMask = VectorMaskBits(VectorCompareGT(DistanceSquared, VectorLoad(&DetectionRangeSquared[Index])));
+
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			InAttackRangeFlags[Index + Lane] = (AttackMask >> Lane) & 1;
+			OutOfDetectionRangeFlags[Index + Lane] = (LostMask >> Lane) & 1;
+		}
+	}
+}
+
+void UEnemyBatchUpdateSubsystem::ApplyStateChanges()
+{
+	const int32 Num = Enemies.Num();
+
+	PendingChanges.Reset();
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		if (ActiveFlags[Index] && (InAttackRangeFlags[Index] || OutOfDetectionRangeFlags[Index]))
+		{
+			PendingChanges.Emplace(Enemies[Index], InAttackRangeFlags[Index] != 0);
+		}
+	}
+
+	for (const TPair<TObjectPtr<ABaseEnemy>, bool>& Change : PendingChanges)
+	{
+		ABaseEnemy* Enemy = Change.Key;
+
+		// 앞선 적의 상태 변경 이벤트가 이 적을 바꿨을 수 있으므로 다시 확인
+		if (!IsValid(Enemy) || !Enemy->IsAlive() || Enemy->GetCurrentState() != EEnemyState::Chasing)
+		{
+			continue;
+		}
+
+		if (Change.Value)
+		{
+			Enemy->SetEnemyState(EEnemyState::Attacking);
+		}
+		else
+		{
+			Enemy->StopChasing();
+		}
+	}
+	PendingChanges.Reset();
+}
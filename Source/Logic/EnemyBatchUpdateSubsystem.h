@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyBatchUpdateSubsystem.generated.h"
+
+class ABaseEnemy;
+
+/**
+ * ABaseEnemy::Tick의 거리 기반 상태 전환(Chasing -> Attacking / Idle)을 한 번에 처리하는 매니저
+ * 적 위치, 타겟 위치, 공격/감지 범위를 struct-of-arrays로 보관하고
+ * 제곱 거리를 4개씩 SIMD로 계산한 뒤 바뀐 상태만 게임 스레드에서 적용한다.
+ * 등록된 적은 자체 Tick이 꺼진다 (ABaseEnemy::bUseBatchedUpdate로 opt-in).
+ */
+UCLASS()
+class LOGIC_API UEnemyBatchUpdateSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// === USubsystem ===
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemyBatchUpdateSubsystem* Get(const UObject* WorldContextObject);
+
+	// 등록하면 적의 액터 Tick이 꺼지고 해제하면 (bRestoreActorTick일 때) 다시 켜진다
+	void RegisterEnemy(ABaseEnemy* Enemy);
+	void UnregisterEnemy(ABaseEnemy* Enemy, bool bRestoreActorTick = true);
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Batch Update")
+	int32 GetNumManagedEnemies() const { return Enemies.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 1. 게임 스레드에서 위치/범위 수집
+	void GatherInputs();
+	// 2. 제곱 거리 계산 및 범위 비교 (SIMD)
+	void ComputeRangeMasks();
+	// 3. 상태가 바뀌는 적에게만 결과 적용
+	void ApplyStateChanges();
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABaseEnemy>> Enemies;
+
+	TMap<const ABaseEnemy*, int32> EnemyIndices;
+
+	// === SoA 입력 (4의 배수로 패딩, 좌표는 프레임 기준점 기준 상대 좌표) ===
+	TArray<float> EnemyX;
+	TArray<float> EnemyY;
+	TArray<float> EnemyZ;
+	TArray<float> TargetX;
+	TArray<float> TargetY;
+	TArray<float> TargetZ;
+	TArray<float> AttackRangeSquared;
+	TArray<float> DetectionRangeSquared;
+
+	// Chasing 중이고 타겟이 있는 적만 1
+	TArray<uint8> ActiveFlags;
+
+	// === 출력 ===
+	TArray<uint8> InAttackRangeFlags;
+	TArray<uint8> OutOfDetectionRangeFlags;
+
+	// 적용 도중 등록 목록이 바뀌어도 안전하도록 변경분을 먼저 모은다 (true = 공격, false = 추적 중지)
+	TArray<TPair<TObjectPtr<ABaseEnemy>, bool>> PendingChanges;
+};
@@ -0,0 +1,381 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyCrowdSubsystem.h"
+#include "BasicSlime.h"
+#include "EnemyPoolSubsystem.h"
+#include "EnemyRegistrySubsystem.h"
+#include "LogicReplaySubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/NetDriver.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorld GEnemyCrowdStatsCommand(
+	TEXT("Logic.EnemyCrowd.Stats"),
+	TEXT("프록시 수와 승격/강등 횟수를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UEnemyCrowdSubsystem* Crowd = UEnemyCrowdSubsystem::Get(World))
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *Crowd->GetStatsString());
+		}
+	}));
+
+UEnemyCrowdSubsystem* UEnemyCrowdSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemyCrowdSubsystem>() : nullptr;
+}
+
+bool UEnemyCrowdSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyCrowdSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 클라이언트는 복제된 적만 보여 줌 (프록시는 서버에만 있음). 데디케이티드 서버는 그릴 화면이 없음
+	if (!IsServerWorld() || InWorld.GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	UStaticMesh* Mesh = ProxyMesh.LoadSynchronous();
+	if (!Mesh)
+	{
+		return;
+	}
+
+	// 프록시 전체를 그릴 인스턴스드 메시 하나
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	AActor* ProxyActor = InWorld.SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!ProxyActor)
+	{
+		return;
+	}
+
+	ProxyInstances = NewObject<UInstancedStaticMeshComponent>(ProxyActor, TEXT("CrowdProxyInstances"));
+	ProxyInstances->SetStaticMesh(Mesh);
+	ProxyInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ProxyInstances->SetCastShadow(false);
+	ProxyActor->SetRootComponent(ProxyInstances);
+	ProxyInstances->RegisterComponent();
+
+	for (const FEnemyCrowdProxy& Proxy : Proxies)
+	{
+		ProxyInstances->AddInstance(GetProxyTransform(Proxy), true);
+	}
+}
+
+void UEnemyCrowdSubsystem::Deinitialize()
+{
+	Proxies.Empty();
+	ProxyInstances = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyCrowdSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyCrowdSubsystem, STATGROUP_Tickables);
+}
+
+bool UEnemyCrowdSubsystem::IsServerWorld() const
+{
+	// 승격/강등은 액터를 풀에서 꺼내거나 반납하므로 서버에서만
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+bool UEnemyCrowdSubsystem::HasRemoteClients() const
+{
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Standalone)
+	{
+		return false;
+	}
+
+	const UNetDriver* NetDriver = World->GetNetDriver();
+	return World->GetNetMode() == NM_DedicatedServer || (NetDriver && NetDriver->ClientConnections.Num() > 0);
+}
+
+void UEnemyCrowdSubsystem::Tick(float DeltaTime)
+{
+	if (!IsServerWorld())
+	{
+		return;
+	}
+
+	UpdateBounces(DeltaTime);
+
+	TimeSinceEvaluation += DeltaTime;
+	if (TimeSinceEvaluation < EvaluationInterval)
+	{
+		return;
+	}
+	TimeSinceEvaluation = 0.0f;
+
+	Evaluate();
+}
+
+void UEnemyCrowdSubsystem::AddProxy(TSubclassOf<ABaseEnemy> EnemyClass, const FTransform& Transform, int32 Level, EEnemyRank Rank)
+{
+	if (!EnemyClass || !IsServerWorld())
+	{
+		return;
+	}
+
+	// 처음 추가될 때는 최대 체력으로
+	const ABaseEnemy* DefaultEnemy = EnemyClass->GetDefaultObject<ABaseEnemy>();
+	float MaxHealth = DefaultEnemy->MaxHealth;
+	if (DefaultEnemy->Archetype)
+	{
+		MaxHealth = DefaultEnemy->Archetype->GetStatBlock(Level, Rank).MaxHealth;
+	}
+	else
+	{
+		FEnemyStatBlock BaseStats;
+		BaseStats.MaxHealth = DefaultEnemy->MaxHealth;
+		MaxHealth = UEnemyArchetype::ComputeStatBlock(BaseStats, Level, Rank).MaxHealth;
+	}
+
+	FEnemyCrowdProxy& Proxy = Proxies.AddDefaulted_GetRef();
+	Proxy.EnemyClass = EnemyClass;
+	Proxy.Location = Transform.GetLocation();
+	Proxy.Yaw = Transform.Rotator().Yaw;
+	Proxy.CurrentHealth = MaxHealth;
+	Proxy.Level = Level;
+	Proxy.Rank = Rank;
+	Proxy.bBounces = EnemyClass->IsChildOf(ABasicSlime::StaticClass());
+	Proxy.BounceTimeRemaining = ULogicReplaySubsystem::RandRange(this, 2.0f, 4.0f);
+
+	if (ProxyInstances)
+	{
+		ProxyInstances->AddInstance(GetProxyTransform(Proxy), true);
+	}
+}
+
+bool UEnemyCrowdSubsystem::DemoteEnemy(ABaseEnemy* Enemy)
+{
+	// 원격 클라이언트에게는 프록시가 보이지 않으므로 적이 그냥 사라짐
+	if (!IsValid(Enemy) || !Enemy->IsAlive() || Enemy->IsInPool() || !IsServerWorld() || HasRemoteClients())
+	{
+		return false;
+	}
+
+	FEnemyCrowdProxy& Proxy = Proxies.AddDefaulted_GetRef();
+	Proxy.EnemyClass = Enemy->GetClass();
+	Proxy.Location = Enemy->GetActorLocation();
+	Proxy.Yaw = Enemy->GetActorRotation().Yaw;
+	Proxy.State = Enemy->GetCurrentState();
+	Proxy.CurrentHealth = Enemy->CurrentHealth;
+	Proxy.Level = Enemy->Level;
+	Proxy.Rank = Enemy->EnemyRank;
+	Proxy.bBounces = Enemy->IsA<ABasicSlime>();
+	Proxy.BounceTimeRemaining = ULogicReplaySubsystem::RandRange(this, 2.0f, 4.0f);
+
+	if (ProxyInstances)
+	{
+		ProxyInstances->AddInstance(GetProxyTransform(Proxy), true);
+	}
+
+	// 액터는 풀로 (풀 소속이 아니면 삭제)
+	UEnemyPoolSubsystem* Pool = Enemy->IsPooled() ? UEnemyPoolSubsystem::Get(this) : nullptr;
+	if (Pool)
+	{
+		Pool->ReleaseEnemy(Enemy);
+	}
+	else
+	{
+		Enemy->Destroy();
+	}
+
+	++NumDemotions;
+	return true;
+}
+
+void UEnemyCrowdSubsystem::UpdateBounces(float DeltaTime)
+{
+	bool bAnyChanged = false;
+
+	for (int32 Index = 0; Index < Proxies.Num(); ++Index)
+	{
+		FEnemyCrowdProxy& Proxy = Proxies[Index];
+		if (!Proxy.bBounces || Proxy.State != EEnemyState::Idle)
+		{
+			continue;
+		}
+
+		const bool bWasBouncing = Proxy.BouncePhase > 0.0f;
+		if (bWasBouncing)
+		{
+			Proxy.BouncePhase += DeltaTime / BounceDuration;
+			if (Proxy.BouncePhase >= 1.0f)
+			{
+				Proxy.BouncePhase = 0.0f;
+			}
+		}
+		else
+		{
+			// ABasicSlime::StartBounceEffect와 같은 2~4초 주기
+			Proxy.BounceTimeRemaining -= DeltaTime;
+			if (Proxy.BounceTimeRemaining > 0.0f)
+			{
+				continue;
+			}
+			Proxy.BounceTimeRemaining = ULogicReplaySubsystem::RandRange(this, 2.0f, 4.0f);
+			Proxy.BouncePhase = KINDA_SMALL_NUMBER;
+		}
+
+		if (ProxyInstances)
+		{
+			ProxyInstances->UpdateInstanceTransform(Index, GetProxyTransform(Proxy), true, false, true);
+			bAnyChanged = true;
+		}
+	}
+
+	if (bAnyChanged)
+	{
+		ProxyInstances->MarkRenderStateDirty();
+	}
+}
+
+void UEnemyCrowdSubsystem::Evaluate()
+{
+	const UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
+	if (!Registry)
+	{
+		return;
+	}
+
+	PlayerLocations.Reset();
+	for (const APawn* Player : Registry->GetRegisteredPlayers())
+	{
+		if (Player)
+		{
+			PlayerLocations.Add(Player->GetActorLocation());
+		}
+	}
+	if (PlayerLocations.Num() == 0)
+	{
+		return;
+	}
+
+	// 가까워진 프록시 승격 (승격하면 뒤의 프록시가 당겨지므로 뒤에서부터)
+	// 원격 클라이언트가 있으면 프록시가 그들에게 보이지 않으므로 거리와 상관없이 승격
+	const bool bRemoteClients = HasRemoteClients();
+	const double PromoteRadiusSquared = FMath::Square((double)PromoteRadius);
+	int32 NumPromotedThisEvaluation = 0;
+	for (int32 Index = Proxies.Num() - 1; Index >= 0 && NumPromotedThisEvaluation < MaxPromotionsPerEvaluation; --Index)
+	{
+		if (bRemoteClients || GetClosestPlayerDistanceSquared(Proxies[Index].Location) <= PromoteRadiusSquared)
+		{
+			PromoteProxy(Index);
+			++NumPromotedThisEvaluation;
+		}
+	}
+
+	// 프록시를 그릴 메시가 없거나 원격 클라이언트가 있으면 적이 보이지 않게 사라지므로 자동 강등하지 않음
+	if (!ProxyInstances || bRemoteClients)
+	{
+		return;
+	}
+
+	// 멀어진 한가한 적 강등 (DemoteEnemy가 레지스트리를 바꾸므로 먼저 모아둠)
+	// 레벨에 배치된 적은 삭제되면 인스턴스별 설정을 잃으므로 풀 소속만 강등
+	const double DemoteRadiusSquared = FMath::Square((double)FMath::Max(DemoteRadius, PromoteRadius));
+	TArray<ABaseEnemy*, TInlineAllocator<32>> ToDemote;
+	for (ABaseEnemy* Enemy : Registry->GetRegisteredEnemies())
+	{
+		if (!Enemy || !Enemy->bAllowCrowdProxy || !Enemy->IsPooled() || !Enemy->IsAlive() || Enemy->GetTarget())
+		{
+			continue;
+		}
+
+		const EEnemyState State = Enemy->GetCurrentState();
+		if (State != EEnemyState::Idle && State != EEnemyState::Patrolling)
+		{
+			continue;
+		}
+
+		if (GetClosestPlayerDistanceSquared(Enemy->GetActorLocation()) > DemoteRadiusSquared)
+		{
+			ToDemote.Add(Enemy);
+		}
+	}
+
+	for (ABaseEnemy* Enemy : ToDemote)
+	{
+		DemoteEnemy(Enemy);
+	}
+}
+
+bool UEnemyCrowdSubsystem::PromoteProxy(int32 Index)
+{
+	UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this);
+	if (!Pool)
+	{
+		return false;
+	}
+
+	// 액터를 얻지 못하면 프록시를 그대로 두고 다음 평가에서 다시 시도
+	const FEnemyCrowdProxy Proxy = Proxies[Index];
+	const FTransform SpawnTransform(FRotator(0.0f, Proxy.Yaw, 0.0f), Proxy.Location);
+	ABaseEnemy* Enemy = Pool->AcquireEnemy(Proxy.EnemyClass, SpawnTransform);
+	if (!Enemy)
+	{
+		return false;
+	}
+
+	Enemy->RestoreFromCrowd(Proxy.Level, Proxy.Rank, Proxy.State, Proxy.CurrentHealth);
+	RemoveProxyAtSwap(Index);
+	++NumPromotions;
+	return true;
+}
+
+void UEnemyCrowdSubsystem::RemoveProxyAtSwap(int32 Index)
+{
+	const int32 LastIndex = Proxies.Num() - 1;
+
+	// 인스턴스 인덱스가 프록시 인덱스와 같도록 마지막 인스턴스를 빈 자리로 옮김
+	if (ProxyInstances)
+	{
+		if (Index != LastIndex)
+		{
+			ProxyInstances->UpdateInstanceTransform(Index, GetProxyTransform(Proxies[LastIndex]), true, true, true);
+		}
+		ProxyInstances->RemoveInstance(LastIndex);
+	}
+
+	Proxies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+FTransform UEnemyCrowdSubsystem::GetProxyTransform(const FEnemyCrowdProxy& Proxy) const
+{
+	FVector Location = Proxy.Location;
+	if (Proxy.BouncePhase > 0.0f)
+	{
+		Location.Z += BounceHeight * FMath::Sin(Proxy.BouncePhase * PI);
+	}
+	return FTransform(FRotator(0.0f, Proxy.Yaw, 0.0f), Location);
+}
+
+double UEnemyCrowdSubsystem::GetClosestPlayerDistanceSquared(const FVector& Location) const
+{
+	double ClosestDistanceSquared = MAX_dbl;
+	for (const FVector& PlayerLocation : PlayerLocations)
+	{
+		ClosestDistanceSquared = FMath::Min(ClosestDistanceSquared, FVector::DistSquared(Location, PlayerLocation));
+	}
+	return ClosestDistanceSquared;
+}
+
+FString UEnemyCrowdSubsystem::GetStatsString() const
+{
+	return FString::Printf(TEXT("Enemy Crowd - Proxies: %d, Promotions: %d, Demotions: %d"),
+		Proxies.Num(), NumPromotions, NumDemotions);
+}
@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BaseEnemy.h"
+#include "EnemyCrowdSubsystem.generated.h"
+
+class UStaticMesh;
+class UInstancedStaticMeshComponent;
+
+// 멀리 있는 적의 경량 표현 (액터 없이 위치/상태/체력만 유지)
+USTRUCT()
+struct FEnemyCrowdProxy
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<ABaseEnemy> EnemyClass;
+
+	FVector Location = FVector::ZeroVector;
+	float Yaw = 0.0f;
+
+	EEnemyState State = EEnemyState::Idle;
+	float CurrentHealth = 0.0f;
+	int32 Level = 1;
+	EEnemyRank Rank = EEnemyRank::Normal;
+
+	// 다음 바운스까지 남은 시간, 바운스 연출 진행도 (0이면 정지)
+	bool bBounces = false;
+	float BounceTimeRemaining = 0.0f;
+	float BouncePhase = 0.0f;
+};
+
+/**
+ * 넓은 지역에 흩어진 적을 액터 대신 가벼운 프록시로 관리하는 서브시스템
+ * 플레이어가 PromoteRadius 안으로 들어오면 풀에서 실제 ABaseEnemy를 꺼내 상태/체력을 이어받게 하고,
+ * DemoteRadius 밖으로 멀어진 한가한 적은 다시 프록시로 바꾼 뒤 액터를 풀에 반납한다.
+ * ProxyMesh를 지정하면 프록시를 인스턴스드 스태틱 메시 하나로 그린다. ProxyMesh가 없으면 자동 강등은 하지 않으며,
+ * 자동 강등 대상은 bAllowCrowdProxy를 켠 풀 소속 적뿐이다 (배치된 적은 인스턴스별 설정을 잃지 않도록 제외).
+ * 프록시 메시는 복제되지 않으므로 강등은 싱글플레이/접속한 클라이언트가 없는 리슨 서버에서만 한다.
+ * 원격 클라이언트가 있으면 강등하지 않고, 남아 있는 프록시는 거리와 상관없이 예산 안에서 승격해 클라이언트에 보이게 한다.
+ */
+UCLASS(config=Game)
+class LOGIC_API UEnemyCrowdSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemyCrowdSubsystem* Get(const UObject* WorldContextObject);
+
+	// 프록시로 적 추가 (레벨 배치/스폰 스크립트용)
+	UFUNCTION(BlueprintCallable, Category = "Enemy Crowd")
+	void AddProxy(TSubclassOf<ABaseEnemy> EnemyClass, const FTransform& Transform, int32 Level = 1, EEnemyRank Rank = EEnemyRank::Normal);
+
+	// 실제 적을 프록시로 전환 (상태/체력 보존)
+	UFUNCTION(BlueprintCallable, Category = "Enemy Crowd")
+	bool DemoteEnemy(ABaseEnemy* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Crowd")
+	int32 GetNumProxies() const { return Proxies.Num(); }
+
+	FString GetStatsString() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 플레이어와 이 거리 안이면 실제 액터로 승격
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Crowd")
+	float PromoteRadius = 4000.0f;
+
+	// 이 거리 밖이면 프록시로 강등 (PromoteRadius보다 커야 경계에서 왔다갔다 하지 않음)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Crowd")
+	float DemoteRadius = 5000.0f;
+
+	// 승격/강등 평가 주기 (초)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Crowd")
+	float EvaluationInterval = 0.5f;
+
+	// 한 번의 평가에서 승격할 최대 수 (한 프레임에 액터가 몰려 생기지 않게)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Crowd")
+	int32 MaxPromotionsPerEvaluation = 8;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Crowd")
+	TSoftObjectPtr<UStaticMesh> ProxyMesh;
+
+	// 프록시 바운스 연출
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Crowd")
+	float BounceHeight = 30.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Crowd")
+	float BounceDuration = 0.4f;
+
+private:
+	bool IsServerWorld() const;
+
+	// 원격 클라이언트가 접속해 있으면 true (데디케이티드 서버 포함). 프록시는 이들에게 보이지 않음
+	bool HasRemoteClients() const;
+	void UpdateBounces(float DeltaTime);
+	void Evaluate();
+	bool PromoteProxy(int32 Index);
+	void RemoveProxyAtSwap(int32 Index);
+	FTransform GetProxyTransform(const FEnemyCrowdProxy& Proxy) const;
+
+	// 가장 가까운 플레이어까지의 거리 제곱 (플레이어가 없으면 MAX_dbl)
+	double GetClosestPlayerDistanceSquared(const FVector& Location) const;
+
+	UPROPERTY(Transient)
+	TArray<FEnemyCrowdProxy> Proxies;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UInstancedStaticMeshComponent> ProxyInstances;
+
+	TArray<FVector> PlayerLocations;
+	float TimeSinceEvaluation = 0.0f;
+	int32 NumPromotions = 0;
+	int32 NumDemotions = 0;
+};
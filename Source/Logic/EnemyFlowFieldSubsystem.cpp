@@ -0,0 +1,580 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyFlowFieldSubsystem.h"
+#include "EnemyRegistrySubsystem.h"
+#include "LogicStats.h"
+#include "GameFramework/Pawn.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace EnemyFlowField
+{
+	// 8방향 이웃 (앞 4개는 직선, 뒤 4개는 대각선)
+	const FIntPoint Offsets[8] =
+	{
+		{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+		{ 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+	};
+
+	// 반대 방향 인덱스
+	const int32 Opposites[8] = { 1, 0, 3, 2, 7, 6, 5, 4 };
+
+	// 간선은 순방향(+X, +Y, +X+Y, +X-Y) 쪽 칸에만 저장
+	FORCEINLINE bool IsForwardDirection(int32 Direction)
+	{
+		return Direction == 0 || Direction == 2 || Direction == 4 || Direction == 5;
+	}
+
+	// 정수 이동 비용 (직선 10, 대각선 14)
+	constexpr int32 StraightCost = 10;
+	constexpr int32 DiagonalCost = 14;
+
+	// 막힌 칸(또는 아직 샘플하지 않은 칸)의 높이
+	constexpr float BlockedHeight = TNumericLimits<float>::Lowest();
+
+	FORCEINLINE bool IsWalkable(float Height)
+	{
+		return Height != BlockedHeight;
+	}
+}
+
+static FAutoConsoleCommandWithWorld GEnemyFlowFieldStatsCommand(
+	TEXT("Logic.FlowField.Stats"),
+	TEXT("흐름장 수, 캐시된 내비메시 샘플 수와 재계산 횟수를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UEnemyFlowFieldSubsystem* FlowField = UEnemyFlowFieldSubsystem::Get(World))
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *FlowField->GetStatsString());
+		}
+	}));
+
+UEnemyFlowFieldSubsystem* UEnemyFlowFieldSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemyFlowFieldSubsystem>() : nullptr;
+}
+
+bool UEnemyFlowFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UEnemyFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyFlowFieldSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyFlowFieldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	CellSize = FMath::Max(CellSize, 10.0f);
+	HalfExtentCells = FMath::Clamp(HalfExtentCells, 4, 256);
+	LookAheadCells = FMath::Max(LookAheadCells, 1);
+
+	// 내비메시가 다시 빌드되면 캐시된 샘플은 더 이상 유효하지 않음
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UEnemyFlowFieldSubsystem::HandleNavigationGenerationFinished);
+	}
+}
+
+void UEnemyFlowFieldSubsystem::Deinitialize()
+{
+	// 백그라운드 계산이 끝날 때까지 기다림 (결과는 버림)
+	for (FFieldState& Field : Fields)
+	{
+		if (Field.bPending)
+		{
+			Field.Pending.Wait();
+		}
+	}
+	Fields.Empty();
+	Chunks.Empty();
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UEnemyFlowFieldSubsystem::HandleNavigationGenerationFinished);
+	}
+
+	Super::Deinitialize();
+}
+
+void UEnemyFlowFieldSubsystem::HandleNavigationGenerationFinished(ANavigationData* NavData)
+{
+	ResetWalkability();
+}
+
+void UEnemyFlowFieldSubsystem::ResetWalkability()
+{
+	Chunks.Reset();
+	++SampleVersion;
+}
+
+void UEnemyFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	// 추적 이동은 서버에서만 결정됨
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	SyncFieldTargets();
+	if (Fields.Num() == 0)
+	{
+		return;
+	}
+
+	LOGIC_COMBAT_SCOPE(STAT_LogicFlowField);
+
+	// 1. 끝난 백그라운드 계산 결과 교체
+	for (FFieldState& Field : Fields)
+	{
+		Field.TimeSinceBuild += DeltaTime;
+		if (Field.bPending && Field.Pending.IsCompleted())
+		{
+			Field.Current = Field.Pending.GetResult();
+			Field.Pending = {};
+			Field.bPending = false;
+			++NumBuilds;
+		}
+	}
+
+	// 2. 플레이어 주변 이동 가능 여부 샘플 (가까운 청크부터, 프레임 예산 내에서)
+	if (Chunks.Num() > MaxCachedChunks)
+	{
+		ResetWalkability();
+	}
+
+	int32 Budget = MaxSamplesPerTick;
+	for (const FFieldState& Field : Fields)
+	{
+		if (const APawn* Target = Field.Target.Get())
+		{
+			const FVector TargetLocation = Target->GetActorLocation();
+			SampleWalkability(ToCell(TargetLocation), TargetLocation.Z, Budget);
+		}
+	}
+
+	// 3. 플레이어가 움직였거나 새 샘플이 쌓였으면 재계산 시작
+	for (FFieldState& Field : Fields)
+	{
+		const APawn* Target = Field.Target.Get();
+		if (!Target || Field.bPending)
+		{
+			continue;
+		}
+
+		const FIntPoint GoalCell = ToCell(Target->GetActorLocation());
+		const FIntPoint Moved = GoalCell - Field.BuiltGoalCell;
+		const bool bMoved = FMath::Max(FMath::Abs(Moved.X), FMath::Abs(Moved.Y)) >= RefreshCellDistance;
+		const bool bNewSamples = Field.BuiltSampleVersion != SampleVersion && Field.TimeSinceBuild >= MinRebuildInterval;
+		if (!Field.Current || bMoved || bNewSamples)
+		{
+			KickBuild(Field, GoalCell);
+		}
+	}
+}
+
+void UEnemyFlowFieldSubsystem::SyncFieldTargets()
+{
+	const UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
+	const TArray<TObjectPtr<APawn>> NoPlayers;
+	const TArray<TObjectPtr<APawn>>& Players = Registry ? Registry->GetRegisteredPlayers() : NoPlayers;
+
+	// 사라진 플레이어의 흐름장 제거 (계산 중이면 끝날 때까지 유지)
+	for (int32 Index = Fields.Num() - 1; Index >= 0; --Index)
+	{
+		const FFieldState& Field = Fields[Index];
+		if (!Field.bPending && (!Field.Target.IsValid() || !Players.Contains(Field.Target.Get())))
+		{
+			Fields.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+
+	for (APawn* Player : Players)
+	{
+		if (IsValid(Player) && !Fields.ContainsByPredicate([Player](const FFieldState& Field) { return Field.Target.Get() == Player; }))
+		{
+			FFieldState& Field = Fields.AddDefaulted_GetRef();
+			Field.Target = Player;
+		}
+	}
+}
+
+void UEnemyFlowFieldSubsystem::SampleWalkability(const FIntPoint& CenterCell, float ReferenceZ, int32& InOutBudget)
+{
+	const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys || InOutBudget <= 0)
+	{
+		return;
+	}
+
+	// 흐름장 범위를 덮는 청크 중 아직 덜 샘플된 것을 가까운 순으로
+	const FIntPoint CenterChunk = GetChunkCoord(CenterCell);
+	const int32 ChunkRadius = FMath::DivideAndRoundUp(HalfExtentCells, ChunkSize);
+
+	TArray<FIntPoint, TInlineAllocator<64>> Incomplete;
+	for (int32 Y = -ChunkRadius; Y <= ChunkRadius; ++Y)
+	{
+		for (int32 X = -ChunkRadius; X <= ChunkRadius; ++X)
+		{
+			const FIntPoint ChunkCoord = CenterChunk + FIntPoint(X, Y);
+			const FWalkabilityChunk* Chunk = Chunks.Find(ChunkCoord);
+			if (!Chunk || Chunk->NumSampled < ChunkSize * ChunkSize)
+			{
+				Incomplete.Add(ChunkCoord);
+			}
+		}
+	}
+	if (Incomplete.Num() == 0)
+	{
+		return;
+	}
+
+	Incomplete.Sort([&CenterChunk](const FIntPoint& A, const FIntPoint& B)
+	{
+		return (A - CenterChunk).SizeSquared() < (B - CenterChunk).SizeSquared();
+	});
+
+	const ANavigationData* NavData = NavSys->GetDefaultNavDataInstance();
+	const FVector QueryExtent(CellSize * 0.5f, CellSize * 0.5f, NavQueryExtentZ);
+	for (const FIntPoint& ChunkCoord : Incomplete)
+	{
+		FWalkabilityChunk& Chunk = Chunks.FindOrAdd(ChunkCoord);
+		if (Chunk.Heights.Num() == 0)
+		{
+			Chunk.Heights.Init(EnemyFlowField::BlockedHeight, ChunkSize * ChunkSize);
+			Chunk.Edges.Init(0, ChunkSize * ChunkSize);
+		}
+
+		while (Chunk.NumSampled < ChunkSize * ChunkSize && InOutBudget > 0)
+		{
+			const int32 Local = Chunk.NumSampled++;
+			const FIntPoint Cell = ChunkCoord * ChunkSize + FIntPoint(Local % ChunkSize, Local / ChunkSize);
+
+			FNavLocation NavLocation;
+			if (NavSys->ProjectPointToNavigation(GetCellCenter(Cell, ReferenceZ), NavLocation, QueryExtent))
+			{
+				Chunk.Heights[Local] = NavLocation.Location.Z;
+				if (NavData)
+				{
+					InOutBudget -= SampleEdges(*NavData, Chunk, Local, Cell);
+				}
+			}
+			--InOutBudget;
+		}
+
+		++SampleVersion;
+		if (InOutBudget <= 0)
+		{
+			break;
+		}
+	}
+}
+
+int32 UEnemyFlowFieldSubsystem::SampleEdges(const ANavigationData& NavData, FWalkabilityChunk& Chunk, int32 Local, const FIntPoint& Cell)
+{
+	using namespace EnemyFlowField;
+
+	// 두 칸 중 나중에 샘플되는 쪽에서 한 번만 레이캐스트 (두 칸 모두 내비메시 위여도 사이에 벽이 있을 수 있음)
+	int32 NumRaycasts = 0;
+	const FVector Start = GetCellCenter(Cell, Chunk.Heights[Local]);
+	for (int32 Direction = 0; Direction < 8; ++Direction)
+	{
+		const FIntPoint NeighborCell = Cell + Offsets[Direction];
+		int32 NeighborLocal = INDEX_NONE;
+		FWalkabilityChunk* NeighborChunk = FindSampledCell(NeighborCell, NeighborLocal);
+		if (!NeighborChunk || !IsWalkable(NeighborChunk->Heights[NeighborLocal]))
+		{
+			continue;
+		}
+
+		FVector HitLocation;
+		++NumRaycasts;
+		if (NavData.Raycast(Start, GetCellCenter(NeighborCell, NeighborChunk->Heights[NeighborLocal]), HitLocation, nullptr))
+		{
+			continue;
+		}
+
+		if (IsForwardDirection(Direction))
+		{
+			Chunk.Edges[Local] |= 1 << Direction;
+		}
+		else
+		{
+			NeighborChunk->Edges[NeighborLocal] |= 1 << Opposites[Direction];
+		}
+	}
+	return NumRaycasts;
+}
+
+UEnemyFlowFieldSubsystem::FWalkabilityChunk* UEnemyFlowFieldSubsystem::FindSampledCell(const FIntPoint& Cell, int32& OutLocal)
+{
+	const FIntPoint ChunkCoord = GetChunkCoord(Cell);
+	FWalkabilityChunk* Chunk = Chunks.Find(ChunkCoord);
+	if (!Chunk)
+	{
+		return nullptr;
+	}
+
+	const FIntPoint LocalCell = Cell - ChunkCoord * ChunkSize;
+	OutLocal = LocalCell.Y * ChunkSize + LocalCell.X;
+	return OutLocal < Chunk->NumSampled ? Chunk : nullptr;
+}
+
+void UEnemyFlowFieldSubsystem::KickBuild(FFieldState& Field, const FIntPoint& GoalCell)
+{
+	// 캐시에서 흐름장 범위만큼 높이 스냅샷 (샘플되지 않은 칸은 막힘)
+	const int32 Size = HalfExtentCells * 2 + 1;
+	const FIntPoint Origin = GoalCell - FIntPoint(HalfExtentCells, HalfExtentCells);
+
+	TArray<float> Heights;
+	Heights.SetNumUninitialized(Size * Size);
+	TArray<uint8> Edges;
+	Edges.SetNumUninitialized(Size * Size);
+
+	FIntPoint CachedChunkCoord(MAX_int32, MAX_int32);
+	const FWalkabilityChunk* CachedChunk = nullptr;
+	for (int32 Y = 0; Y < Size; ++Y)
+	{
+		for (int32 X = 0; X < Size; ++X)
+		{
+			const FIntPoint Cell = Origin + FIntPoint(X, Y);
+			const FIntPoint ChunkCoord = GetChunkCoord(Cell);
+			if (ChunkCoord != CachedChunkCoord)
+			{
+				CachedChunkCoord = ChunkCoord;
+				CachedChunk = Chunks.Find(ChunkCoord);
+			}
+
+			const FIntPoint LocalCell = Cell - ChunkCoord * ChunkSize;
+			const int32 Local = LocalCell.Y * ChunkSize + LocalCell.X;
+			const bool bSampled = CachedChunk && Local < CachedChunk->NumSampled;
+			Heights[Y * Size + X] = bSampled ? CachedChunk->Heights[Local] : EnemyFlowField::BlockedHeight;
+			Edges[Y * Size + X] = bSampled ? CachedChunk->Edges[Local] : 0;
+		}
+	}
+
+	Field.Pending = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[Origin, Size, GoalCell, Heights = MoveTemp(Heights), Edges = MoveTemp(Edges), HeightDelta = MaxHeightDelta]() mutable
+		{
+			return BuildField(Origin, Size, GoalCell, MoveTemp(Heights), MoveTemp(Edges), HeightDelta);
+		});
+	Field.bPending = true;
+	Field.BuiltGoalCell = GoalCell;
+	Field.BuiltSampleVersion = SampleVersion;
+	Field.TimeSinceBuild = 0.0f;
+}
+
+TSharedPtr<const UEnemyFlowFieldSubsystem::FFieldData> UEnemyFlowFieldSubsystem::BuildField(const FIntPoint& Origin, int32 Size, const FIntPoint& GoalCell,
+	TArray<float>&& Heights, TArray<uint8>&& Edges, float MaxHeightDelta)
+{
+	using namespace EnemyFlowField;
+
+	TSharedRef<FFieldData> Data = MakeShared<FFieldData>();
+	Data->Origin = Origin;
+	Data->Size = Size;
+	Data->GoalCell = GoalCell;
+	Data->Heights = MoveTemp(Heights);
+	Data->Edges = MoveTemp(Edges);
+	Data->Directions.Init(DirectionNone, Size * Size);
+
+	const TArray<float>& CellHeights = Data->Heights;
+	const TArray<uint8>& CellEdges = Data->Edges;
+	const int32 NumCells = Size * Size;
+
+	// From에서 Direction 방향 이웃으로 이동 가능한지 (대각선은 양옆 직선 칸도 열려 있어야 모서리를 자르지 않음)
+	auto CanStep = [&CellHeights, &CellEdges, Size, MaxHeightDelta](int32 X, int32 Y, int32 Direction, int32& OutNeighbor) -> bool
+	{
+		const FIntPoint& Offset = Offsets[Direction];
+		const int32 NX = X + Offset.X;
+		const int32 NY = Y + Offset.Y;
+		if (NX < 0 || NY < 0 || NX >= Size || NY >= Size)
+		{
+			return false;
+		}
+
+		const float Height = CellHeights[Y * Size + X];
+		OutNeighbor = NY * Size + NX;
+		const float NeighborHeight = CellHeights[OutNeighbor];
+		if (!IsWalkable(NeighborHeight) || FMath::Abs(NeighborHeight - Height) > MaxHeightDelta)
+		{
+			return false;
+		}
+
+		// 두 칸 사이를 내비메시 위로 지나갈 수 있는지 (순방향 간선은 이 칸, 역방향은 이웃 칸에 저장)
+		const bool bEdgeOpen = IsForwardDirection(Direction)
+			? (CellEdges[Y * Size + X] & (1 << Direction)) != 0
+			: (CellEdges[OutNeighbor] & (1 << Opposites[Direction])) != 0;
+		if (!bEdgeOpen)
+		{
+			return false;
+		}
+
+		if (Direction >= 4)
+		{
+			return IsWalkable(CellHeights[Y * Size + NX]) && IsWalkable(CellHeights[NY * Size + X]);
+		}
+		return true;
+	};
+
+	const int32 GoalX = GoalCell.X - Origin.X;
+	const int32 GoalY = GoalCell.Y - Origin.Y;
+	const int32 GoalIndex = GoalY * Size + GoalX;
+	if (GoalX < 0 || GoalY < 0 || GoalX >= Size || GoalY >= Size || !IsWalkable(CellHeights[GoalIndex]))
+	{
+		return Data;
+	}
+
+	// 목표에서부터 다익스트라 (이동 비용이 대칭이므로 역방향 탐색과 같음)
+	TArray<int32> Costs;
+	Costs.Init(MAX_int32, NumCells);
+	Costs[GoalIndex] = 0;
+
+	using FOpenEntry = TPair<int32, int32>;
+	auto HeapPredicate = [](const FOpenEntry& A, const FOpenEntry& B) { return A.Key < B.Key; };
+
+	TArray<FOpenEntry> Open;
+	Open.Reserve(NumCells / 4);
+	Open.HeapPush(FOpenEntry(0, GoalIndex), HeapPredicate);
+
+	while (Open.Num() > 0)
+	{
+		FOpenEntry Entry;
+		Open.HeapPop(Entry, HeapPredicate, EAllowShrinking::No);
+		const int32 Index = Entry.Value;
+		if (Entry.Key > Costs[Index])
+		{
+			continue;
+		}
+
+		const int32 X = Index % Size;
+		const int32 Y = Index / Size;
+		for (int32 Direction = 0; Direction < 8; ++Direction)
+		{
+			int32 Neighbor = INDEX_NONE;
+			if (!CanStep(X, Y, Direction, Neighbor))
+			{
+				continue;
+			}
+
+			const int32 NewCost = Entry.Key + (Direction < 4 ? StraightCost : DiagonalCost);
+			if (NewCost < Costs[Neighbor])
+			{
+				Costs[Neighbor] = NewCost;
+				Open.HeapPush(FOpenEntry(NewCost, Neighbor), HeapPredicate);
+			}
+		}
+	}
+
+	// 방향장: 각 칸에서 비용이 가장 낮은 이웃 쪽
+	for (int32 Index = 0; Index < NumCells; ++Index)
+	{
+		if (Costs[Index] == MAX_int32)
+		{
+			continue;
+		}
+		if (Index == GoalIndex)
+		{
+			Data->Directions[Index] = DirectionGoal;
+			continue;
+		}
+
+		const int32 X = Index % Size;
+		const int32 Y = Index / Size;
+		int32 BestCost = Costs[Index];
+		for (int32 Direction = 0; Direction < 8; ++Direction)
+		{
+			int32 Neighbor = INDEX_NONE;
+			if (CanStep(X, Y, Direction, Neighbor) && Costs[Neighbor] < BestCost)
+			{
+				BestCost = Costs[Neighbor];
+				Data->Directions[Index] = (uint8)Direction;
+			}
+		}
+	}
+
+	return Data;
+}
+
+bool UEnemyFlowFieldSubsystem::GetWaypoint(const APawn* Target, const FVector& From, FVector& OutWaypoint) const
+{
+	const FFieldState* Field = Fields.FindByPredicate([Target](const FFieldState& State) { return State.Target.Get() == Target; });
+	const FFieldData* Data = Field ? Field->Current.Get() : nullptr;
+	if (!Data)
+	{
+		return false;
+	}
+
+	FIntPoint Local = ToCell(From) - Data->Origin;
+	if (Local.X < 0 || Local.Y < 0 || Local.X >= Data->Size || Local.Y >= Data->Size)
+	{
+		return false;
+	}
+
+	// 방향을 따라 몇 칸 앞으로 (목표 칸에 닿으면 멈춤)
+	int32 Steps = 0;
+	while (Steps < LookAheadCells)
+	{
+		const uint8 Direction = Data->Directions[Local.Y * Data->Size + Local.X];
+		if (Direction == DirectionNone)
+		{
+			return false;
+		}
+		if (Direction == DirectionGoal)
+		{
+			break;
+		}
+
+		Local += EnemyFlowField::Offsets[Direction];
+		++Steps;
+	}
+
+	if (Steps == 0)
+	{
+		return false;
+	}
+
+	OutWaypoint = GetCellCenter(Data->Origin + Local, Data->Heights[Local.Y * Data->Size + Local.X]);
+	return true;
+}
+
+FIntPoint UEnemyFlowFieldSubsystem::ToCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+FVector UEnemyFlowFieldSubsystem::GetCellCenter(const FIntPoint& Cell, float Z) const
+{
+	return FVector((Cell.X + 0.5f) * CellSize, (Cell.Y + 0.5f) * CellSize, Z);
+}
+
+FIntPoint UEnemyFlowFieldSubsystem::GetChunkCoord(const FIntPoint& Cell)
+{
+	return FIntPoint(FMath::DivideAndRoundDown(Cell.X, ChunkSize), FMath::DivideAndRoundDown(Cell.Y, ChunkSize));
+}
+
+FString UEnemyFlowFieldSubsystem::GetStatsString() const
+{
+	int32 NumSampled = 0;
+	for (const TPair<FIntPoint, FWalkabilityChunk>& Pair : Chunks)
+	{
+		NumSampled += Pair.Value.NumSampled;
+	}
+
+	int32 NumPending = 0;
+	int32 NumReady = 0;
+	for (const FFieldState& Field : Fields)
+	{
+		NumPending += Field.bPending ? 1 : 0;
+		NumReady += Field.Current.IsValid() ? 1 : 0;
+	}
+
+	return FString::Printf(TEXT("Flow Fields - Fields: %d (ready %d, building %d), Chunks: %d, Sampled cells: %d, Builds: %d, Grid: %dx%d @ %.0f"),
+		Fields.Num(), NumReady, NumPending, Chunks.Num(), NumSampled, NumBuilds, HalfExtentCells * 2 + 1, HalfExtentCells * 2 + 1, CellSize);
+}
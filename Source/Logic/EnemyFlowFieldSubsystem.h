@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "EnemyFlowFieldSubsystem.generated.h"
+
+class APawn;
+class ANavigationData;
+
+/**
+ * 플레이어별 흐름장(flow field)을 만들어 추적 중인 적들이 개별 경로 요청 없이 따라가게 하는 서브시스템
+ * 플레이어 주변 격자의 이동 가능 여부는 내비메시 투영으로, 이웃 칸 사이 연결은 내비메시 레이캐스트로 조금씩 샘플링해
+ * 청크 단위로 캐시하고 (얇은 벽을 사이에 둔 칸은 이어지지 않음),
+ * 플레이어가 몇 칸 움직이면 격자 스냅샷을 떠서 백그라운드 태스크에서 다익스트라 + 방향장을 다시 계산한다.
+ * 비용은 적 수가 아니라 격자 넓이에 비례한다. 적은 GetWaypoint로 몇 칸 앞 지점을 받아 직선 이동한다.
+ */
+UCLASS(config=Game)
+class LOGIC_API UEnemyFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemyFlowFieldSubsystem* Get(const UObject* WorldContextObject);
+
+	// Target의 흐름장을 따라 From에서 LookAheadCells 칸 앞 지점. 흐름장이 없거나 범위 밖/도달 불가/이미 목표 칸이면 false
+	bool GetWaypoint(const APawn* Target, const FVector& From, FVector& OutWaypoint) const;
+
+	// 이 거리 안에서는 흐름장 대신 타겟을 직접 따라가는 것이 정확함
+	float GetDirectChaseDistance() const { return DirectChaseDistance; }
+
+	FString GetStatsString() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 격자 한 칸의 크기 (언리얼 단위)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Flow Field")
+	float CellSize = 100.0f;
+
+	// 플레이어 중심 흐름장 반경 (칸). 64면 128x128칸
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Flow Field")
+	int32 HalfExtentCells = 64;
+
+	// 프레임당 내비메시 투영 + 레이캐스트 수
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Flow Field")
+	int32 MaxSamplesPerTick = 256;
+
+	// 플레이어가 이만큼(칸) 움직이면 흐름장 재계산
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Flow Field")
+	int32 RefreshCellDistance = 2;
+
+	// 새로 샘플된 칸을 반영하기 위한 최소 재계산 간격 (초)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Flow Field")
+	float MinRebuildInterval = 0.5f;
+
+	// 이웃 칸 높이 차이가 이보다 크면 이동 불가
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Flow Field")
+	float MaxHeightDelta = 75.0f;
+
+	// 내비메시 투영 높이 범위
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Flow Field")
+	float NavQueryExtentZ = 300.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Flow Field")
+	int32 LookAheadCells = 3;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Flow Field")
+	float DirectChaseDistance = 400.0f;
+
+	// 캐시할 최대 청크 수 (넘으면 캐시를 비우고 다시 샘플)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Flow Field")
+	int32 MaxCachedChunks = 4096;
+
+private:
+	static constexpr int32 ChunkSize = 16;
+	static constexpr uint8 DirectionNone = 0xFF;
+	static constexpr uint8 DirectionGoal = 0xFE;
+
+	// 16x16칸 이동 가능 여부 캐시 (앞에서부터 NumSampled칸까지 샘플 완료)
+	struct FWalkabilityChunk
+	{
+		TArray<float> Heights;
+
+		// 칸마다 순방향 이웃(+X, +Y, +X+Y, +X-Y)으로 지나갈 수 있는지 방향 비트. 역방향은 이웃 칸의 비트를 씀
+		TArray<uint8> Edges;
+		int32 NumSampled = 0;
+	};
+
+	// 백그라운드에서 만든 흐름장 (만든 뒤에는 읽기 전용)
+	struct FFieldData
+	{
+		FIntPoint Origin = FIntPoint::ZeroValue;
+		int32 Size = 0;
+		FIntPoint GoalCell = FIntPoint::ZeroValue;
+		TArray<float> Heights;
+		TArray<uint8> Edges;
+		TArray<uint8> Directions;
+	};
+
+	struct FFieldState
+	{
+		TWeakObjectPtr<APawn> Target;
+		TSharedPtr<const FFieldData> Current;
+		UE::Tasks::TTask<TSharedPtr<const FFieldData>> Pending;
+		bool bPending = false;
+		FIntPoint BuiltGoalCell = FIntPoint::ZeroValue;
+		int32 BuiltSampleVersion = INDEX_NONE;
+		float TimeSinceBuild = 0.0f;
+	};
+
+	static TSharedPtr<const FFieldData> BuildField(const FIntPoint& Origin, int32 Size, const FIntPoint& GoalCell, TArray<float>&& Heights, TArray<uint8>&& Edges, float MaxHeightDelta);
+
+	UFUNCTION()
+	void HandleNavigationGenerationFinished(ANavigationData* NavData);
+
+	void SyncFieldTargets();
+	void SampleWalkability(const FIntPoint& CenterCell, float ReferenceZ, int32& InOutBudget);
+
+	// 방금 샘플한 칸과 이미 샘플된 이웃 칸 사이를 레이캐스트해 간선 비트를 기록. 레이캐스트 수를 돌려줌
+	int32 SampleEdges(const ANavigationData& NavData, FWalkabilityChunk& Chunk, int32 Local, const FIntPoint& Cell);
+	FWalkabilityChunk* FindSampledCell(const FIntPoint& Cell, int32& OutLocal);
+	void KickBuild(FFieldState& Field, const FIntPoint& GoalCell);
+	void ResetWalkability();
+
+	FIntPoint ToCell(const FVector& Location) const;
+	FVector GetCellCenter(const FIntPoint& Cell, float Z) const;
+	static FIntPoint GetChunkCoord(const FIntPoint& Cell);
+
+	TMap<FIntPoint, FWalkabilityChunk> Chunks;
+	TArray<FFieldState> Fields;
+
+	// 샘플이 추가될 때마다 증가 (흐름장 재계산 판단용)
+	int32 SampleVersion = 0;
+	int32 NumBuilds = 0;
+};
@@ -0,0 +1,119 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyHealthBarOverlay.h"
+#include "BaseEnemy.h"
+#include "EnemyRegistrySubsystem.h"
+#include "LogicStats.h"
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "GameFramework/PlayerController.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+
+UEnemyHealthBarOverlay::UEnemyHealthBarOverlay(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SetVisibility(ESlateVisibility::HitTestInvisible);
+}
+
+void UEnemyHealthBarOverlay::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	Bars.Reset();
+}
+
+void UEnemyHealthBarOverlay::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	LOGIC_COMBAT_SCOPE(STAT_LogicHealthBars);
+
+	Bars.Reset();
+
+	APlayerController* PlayerController = GetOwningPlayer();
+	const UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
+	if (!PlayerController || !PlayerController->PlayerCameraManager || !Registry)
+	{
+		return;
+	}
+
+	// 거리 컬링은 레지스트리 그리드 검색으로
+	const FVector ViewLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+	QueryScratch.Reset();
+	Registry->QueryRadius(ViewLocation, MaxDrawDistance, QueryScratch);
+	if (QueryScratch.Num() == 0)
+	{
+		return;
+	}
+
+	int32 ViewportX = 0;
+	int32 ViewportY = 0;
+	PlayerController->GetViewportSize(ViewportX, ViewportY);
+	const float ViewportScale = UWidgetLayoutLibrary::GetViewportScale(this);
+	if (ViewportX <= 0 || ViewportY <= 0 || ViewportScale <= 0.0f)
+	{
+		return;
+	}
+
+	for (const ABaseEnemy* Enemy : QueryScratch)
+	{
+		if (!Enemy || !Enemy->ShouldShowHealthBar())
+		{
+			continue;
+		}
+
+		const float Percent = Enemy->GetHealthBarPercent();
+		if (bHideAtFullHealth && Percent >= 1.0f)
+		{
+			continue;
+		}
+
+		// 카메라 뒤(투영 실패)거나 화면 밖이면 컬링
+		FVector2D ScreenPosition;
+		if (!PlayerController->ProjectWorldLocationToScreen(Enemy->GetHealthBarLocation(), ScreenPosition, true))
+		{
+			continue;
+		}
+		if (ScreenPosition.X < -BarSize.X || ScreenPosition.X > ViewportX + BarSize.X
+			|| ScreenPosition.Y < -BarSize.Y || ScreenPosition.Y > ViewportY + BarSize.Y)
+		{
+			continue;
+		}
+
+		Bars.Add({ ScreenPosition / ViewportScale, Percent });
+	}
+}
+
+int32 UEnemyHealthBarOverlay::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	LayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
+	if (Bars.Num() == 0)
+	{
+		return LayerId;
+	}
+
+	// 모든 배경을 한 레이어, 모든 채움을 다음 레이어에 그려서 같은 브러시끼리 배치되도록
+	const FSlateBrush* Brush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
+	const int32 BackgroundLayer = LayerId + 1;
+	const int32 FillLayer = LayerId + 2;
+
+	for (const FBarDrawData& Bar : Bars)
+	{
+		const FVector2D TopLeft = Bar.Position - BarSize * 0.5f;
+
+		FSlateDrawElement::MakeBox(OutDrawElements, BackgroundLayer,
+			AllottedGeometry.ToPaintGeometry(BarSize, FSlateLayoutTransform(TopLeft)),
+			Brush, ESlateDrawEffect::None, BackgroundColor);
+
+		if (Bar.Percent > 0.0f)
+		{
+			FSlateDrawElement::MakeBox(OutDrawElements, FillLayer,
+				AllottedGeometry.ToPaintGeometry(FVector2D(BarSize.X * Bar.Percent, BarSize.Y), FSlateLayoutTransform(TopLeft)),
+				Brush, ESlateDrawEffect::None, FillColor);
+		}
+	}
+
+	return FillLayer;
+}
@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "EnemyHealthBarOverlay.generated.h"
+
+class ABaseEnemy;
+
+/**
+ * 화면의 모든 적 체력바를 한 번의 페인트로 그리는 HUD 오버레이
+ * 적마다 UWidgetComponent를 두는 대신 UEnemyRegistrySubsystem에서 카메라 주변 적만 가져와
+ * 거리/화면 밖 컬링 후 박스 두 개(배경/채움)씩 그린다. 체력 비율은 적이 데미지 때 캐시한 값을 사용한다.
+ */
+UCLASS()
+class LOGIC_API UEnemyHealthBarOverlay : public UUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	UEnemyHealthBarOverlay(const FObjectInitializer& ObjectInitializer);
+
+	UFUNCTION(BlueprintPure, Category = "Health Bar")
+	int32 GetNumVisibleBars() const { return Bars.Num(); }
+
+protected:
+	virtual void NativeConstruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+	// 카메라에서 이 거리 밖의 적은 그리지 않음
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Health Bar")
+	float MaxDrawDistance = 3000.0f;
+
+	// 체력이 가득 찬 적은 숨김
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Health Bar")
+	bool bHideAtFullHealth = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Health Bar")
+	FVector2D BarSize = FVector2D(60.0f, 6.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Health Bar")
+	FLinearColor FillColor = FLinearColor(0.8f, 0.1f, 0.1f, 1.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Health Bar")
+	FLinearColor BackgroundColor = FLinearColor(0.0f, 0.0f, 0.0f, 0.6f);
+
+private:
+	struct FBarDrawData
+	{
+		// 위젯 로컬 좌표 (바 중앙)
+		FVector2D Position;
+		float Percent;
+	};
+
+	// NativeTick에서 모으고 NativePaint에서 그림
+	TArray<FBarDrawData> Bars;
+	TArray<ABaseEnemy*> QueryScratch;
+};
@@ -0,0 +1,180 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyLODSubsystem.h"
+#include "BaseEnemy.h"
+#include "EnemyRegistrySubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorld GEnemyLODStatsCommand(
+	TEXT("Logic.EnemyLOD.Stats"),
+	TEXT("버킷별 적 수를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UEnemyLODSubsystem* LOD = UEnemyLODSubsystem::Get(World))
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *LOD->GetStatsString());
+		}
+	}));
+
+UEnemyLODSubsystem::UEnemyLODSubsystem()
+{
+	Buckets.SetNum(4);
+
+	FEnemyLODBucketSettings& Near = Buckets[(int32)EEnemyLODBucket::Near];
+	Near.MaxDistance = 1500.0f;
+	Near.SensingInterval = 0.5f;
+
+	FEnemyLODBucketSettings& Mid = Buckets[(int32)EEnemyLODBucket::Mid];
+	Mid.MaxDistance = 3500.0f;
+	Mid.ActorTickInterval = 0.1f;
+	Mid.MovementTickInterval = 0.033f;
+	Mid.AnimationTickInterval = 0.033f;
+	Mid.SensingInterval = 1.0f;
+
+	FEnemyLODBucketSettings& Far = Buckets[(int32)EEnemyLODBucket::Far];
+	Far.MaxDistance = 7000.0f;
+	Far.ActorTickInterval = 0.25f;
+	Far.MovementTickInterval = 0.1f;
+	Far.AnimationTickInterval = 0.1f;
+	Far.SensingInterval = 2.0f;
+	Far.bShowHealthBar = false;
+
+	FEnemyLODBucketSettings& Dormant = Buckets[(int32)EEnemyLODBucket::Dormant];
+	Dormant.ActorTickInterval = 1.0f;
+	Dormant.MovementTickInterval = 0.5f;
+	Dormant.AnimationTickInterval = 0.5f;
+	Dormant.bEnableSensing = false;
+	Dormant.bShowHealthBar = false;
+}
+
+UEnemyLODSubsystem* UEnemyLODSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemyLODSubsystem>() : nullptr;
+}
+
+bool UEnemyLODSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UEnemyLODSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyLODSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyLODSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceEvaluation += DeltaTime;
+	if (TimeSinceEvaluation < EvaluationInterval)
+	{
+		return;
+	}
+	TimeSinceEvaluation = 0.0f;
+
+	EvaluateBuckets();
+}
+
+int32 UEnemyLODSubsystem::GetBucketCount(EEnemyLODBucket Bucket) const
+{
+	return BucketCounts[(int32)Bucket];
+}
+
+const FEnemyLODBucketSettings& UEnemyLODSubsystem::GetBucketSettings(EEnemyLODBucket Bucket) const
+{
+	// 설정 파일에서 버킷이 덜 들어온 경우 마지막 항목 사용
+	return Buckets[FMath::Min((int32)Bucket, Buckets.Num() - 1)];
+}
+
+FString UEnemyLODSubsystem::GetStatsString() const
+{
+	return FString::Printf(TEXT("Enemy LOD - Near: %d, Mid: %d, Far: %d, Dormant: %d"),
+		BucketCounts[0], BucketCounts[1], BucketCounts[2], BucketCounts[3]);
+}
+
+void UEnemyLODSubsystem::GatherViewLocations()
+{
+	ViewLocations.Reset();
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+}
+
+EEnemyLODBucket UEnemyLODSubsystem::ComputeBucket(EEnemyLODBucket CurrentBucket, float Distance, bool bRecentlyRendered) const
+{
+	const int32 LastBucket = FMath::Min(Buckets.Num(), (int32)UE_ARRAY_COUNT(BucketCounts)) - 1;
+	int32 Bucket = FMath::Min((int32)CurrentBucket, LastBucket);
+
+	// 멀어질 때는 경계 + 여유를 넘어야 한 단계 내려감
+	while (Bucket < LastBucket && Distance > Buckets[Bucket].MaxDistance + HysteresisDistance)
+	{
+		++Bucket;
+	}
+
+	// 가까워질 때는 경계 - 여유 안쪽으로 들어와야 한 단계 올라감
+	while (Bucket > 0 && Distance < Buckets[Bucket - 1].MaxDistance - HysteresisDistance)
+	{
+		--Bucket;
+	}
+
+	if (bDemoteWhenNotRendered && !bRecentlyRendered && Bucket < LastBucket - 1)
+	{
+		++Bucket;
+	}
+
+	return (EEnemyLODBucket)Bucket;
+}
+
+void UEnemyLODSubsystem::EvaluateBuckets()
+{
+	FMemory::Memzero(BucketCounts);
+
+	const UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
+	if (!Registry || Buckets.Num() == 0)
+	{
+		return;
+	}
+
+	GatherViewLocations();
+	if (ViewLocations.Num() == 0)
+	{
+		return;
+	}
+
+	// 데디케이티드 서버는 렌더링하지 않아 WasRecentlyRendered가 항상 false이므로 거리로만 판단
+	const bool bUseRenderVisibility = !GetWorld()->IsNetMode(NM_DedicatedServer);
+
+	for (ABaseEnemy* Enemy : Registry->GetRegisteredEnemies())
+	{
+		if (!Enemy || !Enemy->bUseSignificanceLOD)
+		{
+			continue;
+		}
+
+		// 가장 가까운 플레이어 시점 기준
+		const FVector EnemyLocation = Enemy->GetActorLocation();
+		float ClosestDistanceSquared = MAX_FLT;
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			ClosestDistanceSquared = FMath::Min(ClosestDistanceSquared, (float)FVector::DistSquared(EnemyLocation, ViewLocation));
+		}
+
+		const EEnemyLODBucket NewBucket = ComputeBucket(Enemy->GetLODBucket(), FMath::Sqrt(ClosestDistanceSquared), !bUseRenderVisibility || Enemy->WasRecentlyRendered(0.5f));
+		if (NewBucket != Enemy->GetLODBucket())
+		{
+			Enemy->ApplyLODBucket(NewBucket, GetBucketSettings(NewBucket));
+		}
+
+		++BucketCounts[(int32)NewBucket];
+	}
+}
@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyLODSubsystem.generated.h"
+
+class ABaseEnemy;
+
+// 적 LOD 버킷 (가까운 순서)
+UENUM(BlueprintType)
+enum class EEnemyLODBucket : uint8
+{
+	Near        UMETA(DisplayName = "Near"),
+	Mid         UMETA(DisplayName = "Mid"),
+	Far         UMETA(DisplayName = "Far"),
+	Dormant     UMETA(DisplayName = "Dormant")
+};
+
+// 버킷별 업데이트 빈도 설정
+USTRUCT(BlueprintType)
+struct FEnemyLODBucketSettings
+{
+	GENERATED_BODY()
+
+	// 이 거리까지 해당 버킷 (마지막 버킷은 무시)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy LOD")
+	float MaxDistance = 0.0f;
+
+	// 0이면 매 프레임
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy LOD")
+	float ActorTickInterval = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy LOD")
+	float MovementTickInterval = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy LOD")
+	float AnimationTickInterval = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy LOD")
+	float SensingInterval = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy LOD")
+	bool bEnableSensing = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy LOD")
+	bool bShowHealthBar = true;
+};
+
+/**
+ * 플레이어와의 거리/가시성으로 적마다 LOD 버킷을 정하고
+ * 버킷별로 액터, 이동, 애니메이션, 감지, 체력바 업데이트 빈도를 조절하는 서브시스템
+ * 버킷 경계에는 HysteresisDistance 만큼의 여유를 둬서 경계에서 버킷이 왔다갔다 하지 않게 한다.
+ */
+UCLASS(config=Game)
+class LOGIC_API UEnemyLODSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UEnemyLODSubsystem();
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemyLODSubsystem* Get(const UObject* WorldContextObject);
+
+	// 버킷별 현재 적 수 (마지막 평가 기준)
+	UFUNCTION(BlueprintPure, Category = "Enemy LOD")
+	int32 GetBucketCount(EEnemyLODBucket Bucket) const;
+
+	const FEnemyLODBucketSettings& GetBucketSettings(EEnemyLODBucket Bucket) const;
+
+	// 콘솔 출력용 요약 문자열
+	FString GetStatsString() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 평가 주기 (초)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy LOD")
+	float EvaluationInterval = 0.25f;
+
+	// 버킷 경계 여유 거리
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy LOD")
+	float HysteresisDistance = 200.0f;
+
+	// 화면에 보이지 않는 적은 한 단계 먼 버킷으로 (Dormant로는 내리지 않음)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy LOD")
+	bool bDemoteWhenNotRendered = true;
+
+	// Near, Mid, Far, Dormant 순서
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy LOD")
+	TArray<FEnemyLODBucketSettings> Buckets;
+
+private:
+	void EvaluateBuckets();
+	EEnemyLODBucket ComputeBucket(EEnemyLODBucket CurrentBucket, float Distance, bool bRecentlyRendered) const;
+	void GatherViewLocations();
+
+	float TimeSinceEvaluation = 0.0f;
+	TArray<FVector> ViewLocations;
+	int32 BucketCounts[4] = { 0, 0, 0, 0 };
+};
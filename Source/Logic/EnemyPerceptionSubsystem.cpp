@@ -0,0 +1,226 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyPerceptionSubsystem.h"
+#include "BaseEnemy.h"
+#include "EnemyRegistrySubsystem.h"
+#include "EnemyLODSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+UEnemyPerceptionSubsystem* UEnemyPerceptionSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemyPerceptionSubsystem>() : nullptr;
+}
+
+bool UEnemyPerceptionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyPerceptionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TraceDelegate.BindUObject(this, &UEnemyPerceptionSubsystem::OnTraceCompleted);
+}
+
+void UEnemyPerceptionSubsystem::Deinitialize()
+{
+	TraceDelegate.Unbind();
+	PendingTraces.Empty();
+	InFlightTraces.Empty();
+	VisiblePairs.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyPerceptionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyPerceptionSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyPerceptionSubsystem::Tick(float DeltaTime)
+{
+	// 감지 결과는 서버에서만 쓰임 (클라이언트의 적도 레지스트리에 있지만 검사하지 않음)
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	TimeSinceRound += DeltaTime;
+
+	// 이전 라운드의 대기열이 비어야 다음 라운드 시작 (예산 초과 시 자연스럽게 주기가 늘어남)
+	if (TimeSinceRound >= PerceptionInterval && PendingTraces.Num() == 0)
+	{
+		TimeSinceRound = 0.0f;
+		StartRound();
+	}
+
+	IssueTraces();
+}
+
+void UEnemyPerceptionSubsystem::StartRound()
+{
+	const UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
+	if (!Registry)
+	{
+		return;
+	}
+
+	// 죽었거나 사라진 쌍 정리
+	for (TSet<FSightPair>::TIterator It = VisiblePairs.CreateIterator(); It; ++It)
+	{
+		if (!It->Enemy.IsValid() || !It->Player.IsValid() || !It->Enemy->IsAlive())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	const TArray<TObjectPtr<APawn>>& Players = Registry->GetRegisteredPlayers();
+	if (Players.Num() == 0)
+	{
+		return;
+	}
+
+	const UEnemyLODSubsystem* LOD = UEnemyLODSubsystem::Get(this);
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(PeripheralVisionAngle));
+
+	for (ABaseEnemy* Enemy : Registry->GetRegisteredEnemies())
+	{
+		if (!Enemy || !Enemy->bUseSharedPerception || !Enemy->IsAlive())
+		{
+			continue;
+		}
+
+		// LOD 버킷의 감지 설정 적용: 꺼져 있으면 건너뛰고, 느린 버킷은 몇 라운드에 한 번만 검사
+		if (LOD)
+		{
+			const FEnemyLODBucketSettings& Settings = LOD->GetBucketSettings(Enemy->GetLODBucket());
+			if (!Settings.bEnableSensing)
+			{
+				continue;
+			}
+
+			const uint32 RoundStride = (uint32)FMath::Max(1, FMath::RoundToInt(Settings.SensingInterval / PerceptionInterval));
+			if ((RoundIndex + Enemy->GetUniqueID()) % RoundStride != 0)
+			{
+				continue;
+			}
+		}
+
+		const FVector EyeLocation = Enemy->GetPawnViewLocation();
+		const FVector Forward = Enemy->GetActorForwardVector();
+		const float SightRadiusSquared = FMath::Square(Enemy->DetectionRange);
+
+		for (APawn* Player : Players)
+		{
+			if (!Player)
+			{
+				continue;
+			}
+
+			const FSightPair Pair{ Enemy, Player };
+			const FVector ToPlayer = Player->GetActorLocation() - EyeLocation;
+			const float DistanceSquared = ToPlayer.SizeSquared();
+
+			const bool bInSightCone = DistanceSquared <= SightRadiusSquared
+				&& FVector::DotProduct(Forward, ToPlayer) >= CosHalfAngle * FMath::Sqrt(DistanceSquared);
+
+			if (bInSightCone)
+			{
+				// 시야 확인은 트레이스로
+				PendingTraces.Add(Pair);
+			}
+			else
+			{
+				SetPairVisible(Pair, false);
+			}
+		}
+	}
+
+	++RoundIndex;
+}
+
+void UEnemyPerceptionSubsystem::IssueTraces()
+{
+	UWorld* World = GetWorld();
+	if (!World || PendingTraces.Num() == 0)
+	{
+		return;
+	}
+
+	int32 NumIssued = 0;
+	int32 Index = 0;
+	for (; Index < PendingTraces.Num() && NumIssued < MaxTracesPerFrame; ++Index)
+	{
+		const FSightPair& Pair = PendingTraces[Index];
+		ABaseEnemy* Enemy = Pair.Enemy.Get();
+		APawn* Player = Pair.Player.Get();
+		if (!Enemy || !Player)
+		{
+			continue;
+		}
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(EnemyPerceptionSight), true);
+		QueryParams.AddIgnoredActor(Enemy);
+		QueryParams.AddIgnoredActor(Player);
+
+		const uint32 RequestId = NextRequestId++;
+		World->AsyncLineTraceByChannel(
+			EAsyncTraceType::Test,
+			Enemy->GetPawnViewLocation(),
+			Player->GetActorLocation(),
+			ECC_Visibility,
+			QueryParams,
+			FCollisionResponseParams::DefaultResponseParam,
+			&TraceDelegate,
+			RequestId);
+
+		InFlightTraces.Add(RequestId, Pair);
+		++NumIssued;
+	}
+
+	PendingTraces.RemoveAt(0, Index, EAllowShrinking::No);
+}
+
+void UEnemyPerceptionSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	FSightPair Pair;
+	if (!InFlightTraces.RemoveAndCopyValue(Datum.UserData, Pair))
+	{
+		return;
+	}
+
+	const bool bBlocked = Datum.OutHits.ContainsByPredicate([](const FHitResult& Hit)
+	{
+		return Hit.bBlockingHit;
+	});
+
+	SetPairVisible(Pair, !bBlocked);
+}
+
+void UEnemyPerceptionSubsystem::SetPairVisible(const FSightPair& Pair, bool bVisible)
+{
+	ABaseEnemy* Enemy = Pair.Enemy.Get();
+	APawn* Player = Pair.Player.Get();
+	if (!Enemy || !Player)
+	{
+		return;
+	}
+
+	if (bVisible)
+	{
+		bool bAlreadyVisible = false;
+		VisiblePairs.Add(Pair, &bAlreadyVisible);
+		if (!bAlreadyVisible)
+		{
+			Enemy->HandleSharedPerception(Player, true);
+		}
+	}
+	else if (VisiblePairs.Remove(Pair) > 0)
+	{
+		Enemy->HandleSharedPerception(Player, false);
+	}
+}
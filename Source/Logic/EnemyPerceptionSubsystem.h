@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "EnemyPerceptionSubsystem.generated.h"
+
+class ABaseEnemy;
+class APawn;
+
+/**
+ * 적마다 UPawnSensingComponent를 돌리는 대신 일정 주기로 모든 적 x 등록된 플레이어를 한 번에 검사하는 감지 서비스
+ * 1. 반경/시야각은 벡터 연산으로 먼저 거르고
+ * 2. 통과한 쌍만 비동기 라인 트레이스로 시야를 확인한다 (프레임당 트레이스 수 제한)
+ * 보임/안보임이 바뀐 적에게만 OnPawnSeen/OnPawnLost를 전달한다.
+ * bUseSharedPerception을 켠 적만 대상이며 서버에서만 동작한다.
+ */
+UCLASS(config=Game)
+class LOGIC_API UEnemyPerceptionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// === USubsystem ===
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemyPerceptionSubsystem* Get(const UObject* WorldContextObject);
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Perception")
+	int32 GetNumPendingTraces() const { return PendingTraces.Num() + InFlightTraces.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 한 라운드(전체 적 검사) 주기
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Perception")
+	float PerceptionInterval = 0.2f;
+
+	// 프레임당 최대 비동기 트레이스 수
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Perception")
+	int32 MaxTracesPerFrame = 32;
+
+	// UPawnSensingComponent::PeripheralVisionAngle과 같은 의미 (반각, 도)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Perception")
+	float PeripheralVisionAngle = 90.0f;
+
+private:
+	struct FSightPair
+	{
+		TWeakObjectPtr<ABaseEnemy> Enemy;
+		TWeakObjectPtr<APawn> Player;
+
+		bool operator==(const FSightPair& Other) const { return Enemy == Other.Enemy && Player == Other.Player; }
+		friend uint32 GetTypeHash(const FSightPair& Pair) { return HashCombine(GetTypeHash(Pair.Enemy), GetTypeHash(Pair.Player)); }
+	};
+
+	// 벡터 연산으로 후보를 고르고 트레이스 대기열을 채운다
+	void StartRound();
+	// 예산 안에서 대기열의 트레이스를 발행
+	void IssueTraces();
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+	// 보임 여부가 바뀐 경우에만 적에게 알림
+	void SetPairVisible(const FSightPair& Pair, bool bVisible);
+
+	float TimeSinceRound = 0.0f;
+	uint32 RoundIndex = 0;
+	uint32 NextRequestId = 0;
+
+	TArray<FSightPair> PendingTraces;
+	TMap<uint32, FSightPair> InFlightTraces;
+
+	// 현재 보이는 (적, 플레이어) 쌍
+	TSet<FSightPair> VisiblePairs;
+
+	FTraceDelegate TraceDelegate;
+};
@@ -0,0 +1,535 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyPersistenceSubsystem.h"
+#include "EnemyRegistrySubsystem.h"
+#include "EnemyPoolSubsystem.h"
+#include "EnemySpawnSubsystem.h"
+#include "Engine/Level.h"
+#include "Engine/LevelBounds.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace EnemyPersistence
+{
+	// 레코드 형식이 바뀌면 올림 (형식이 다른 레코드는 버림)
+	constexpr uint8 RecordVersion = 1;
+
+	// 상태 바이트: 하위 3비트 EEnemyState, 최상위 비트 사망
+	constexpr uint8 StateMask = 0x07;
+	constexpr uint8 DeadFlag = 0x80;
+
+	uint8 PackState(const FEnemyPersistedState& State)
+	{
+		return ((uint8)State.State & StateMask) | (State.bIsDead ? DeadFlag : 0);
+	}
+
+	void UnpackState(uint8 Packed, FEnemyPersistedState& OutState)
+	{
+		OutState.State = (EEnemyState)FMath::Min<uint8>(Packed & StateMask, (uint8)EEnemyState::Dead);
+		OutState.bIsDead = (Packed & DeadFlag) != 0;
+	}
+
+	// 체력 비율과 Yaw는 16비트로 양자화
+	uint16 PackHealth(float Fraction)
+	{
+		return (uint16)FMath::RoundToInt(FMath::Clamp(Fraction, 0.0f, 1.0f) * (float)MAX_uint16);
+	}
+
+	float UnpackHealth(uint16 Packed)
+	{
+		return (float)Packed / (float)MAX_uint16;
+	}
+
+	int16 PackYaw(float Yaw)
+	{
+		return (int16)FMath::Clamp(FMath::RoundToInt(FRotator::NormalizeAxis(Yaw) * (32767.0f / 180.0f)), -32767, 32767);
+	}
+
+	float UnpackYaw(int16 Packed)
+	{
+		return (float)Packed * (180.0f / 32767.0f);
+	}
+
+	// 위치/상태/체력/Yaw 공통 부분
+	void SerializeCommon(FArchive& Ar, FEnemyPersistedState& State)
+	{
+		uint8 Packed = Ar.IsSaving() ? PackState(State) : 0;
+		uint16 Health = Ar.IsSaving() ? PackHealth(State.HealthFraction) : 0;
+		FVector3f Location = Ar.IsSaving() ? FVector3f(State.Location) : FVector3f::ZeroVector;
+		int16 Yaw = Ar.IsSaving() ? PackYaw(State.Yaw) : 0;
+
+		Ar << Packed << Health << Location << Yaw;
+
+		if (Ar.IsLoading())
+		{
+			UnpackState(Packed, State);
+			State.HealthFraction = UnpackHealth(Health);
+			State.Location = FVector(Location);
+			State.Yaw = UnpackYaw(Yaw);
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorld GEnemyPersistenceStatsCommand(
+	TEXT("Logic.EnemyPersistence.Stats"),
+	TEXT("셀별로 보존된 적 수와 레코드 크기, 복원/재스폰 수를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UEnemyPersistenceSubsystem* Persistence = UEnemyPersistenceSubsystem::Get(World))
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *Persistence->GetStatsString());
+		}
+	}));
+
+UEnemyPersistenceSubsystem* UEnemyPersistenceSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemyPersistenceSubsystem>() : nullptr;
+}
+
+bool UEnemyPersistenceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyPersistenceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 런타임 적 재스폰에 사용
+	Collection.InitializeDependency<UEnemySpawnSubsystem>();
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UEnemyPersistenceSubsystem::HandleLevelAdded);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UEnemyPersistenceSubsystem::HandleLevelRemoved);
+}
+
+void UEnemyPersistenceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (UEnemySpawnSubsystem* Spawner = UEnemySpawnSubsystem::Get(this))
+	{
+		SpawnCompletedHandle = Spawner->OnEnemySpawnCompletedNative.AddUObject(this, &UEnemyPersistenceSubsystem::HandleSpawnCompleted);
+	}
+}
+
+void UEnemyPersistenceSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	if (UEnemySpawnSubsystem* Spawner = UEnemySpawnSubsystem::Get(this))
+	{
+		Spawner->OnEnemySpawnCompletedNative.Remove(SpawnCompletedHandle);
+	}
+
+	Cells.Empty();
+	CapturedCells.Empty();
+	DecodedCells.Empty();
+	PendingRespawns.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UEnemyPersistenceSubsystem::IsServerWorld() const
+{
+	// 적 상태는 서버가 결정하고 클라이언트는 복제로 받음
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+FName UEnemyPersistenceSubsystem::GetCellKey(const ULevel* Level)
+{
+	// 셀(스트리밍 레벨)마다 고유한 패키지 이름
+	return Level->GetOutermost()->GetFName();
+}
+
+uint32 UEnemyPersistenceSubsystem::GetEnemyKey(const ABaseEnemy* Enemy)
+{
+	// 배치된 액터 이름은 셀이 다시 로드돼도 같음
+	return FCrc::StrCrc32(*Enemy->GetFName().ToString());
+}
+
+FEnemyPersistedState UEnemyPersistenceSubsystem::MakeState(const ABaseEnemy* Enemy)
+{
+	FEnemyPersistedState State;
+	State.Location = Enemy->GetActorLocation();
+	State.Yaw = Enemy->GetActorRotation().Yaw;
+	State.State = Enemy->GetCurrentState();
+	State.HealthFraction = Enemy->MaxHealth > 0.0f ? Enemy->CurrentHealth / Enemy->MaxHealth : 0.0f;
+	State.bIsDead = !Enemy->IsAlive();
+	State.Level = Enemy->Level;
+	State.Rank = Enemy->EnemyRank;
+	return State;
+}
+
+bool UEnemyPersistenceSubsystem::FindPersistedState(const ABaseEnemy* Enemy, FEnemyPersistedState& OutState)
+{
+	const ULevel* Level = Enemy ? Enemy->GetLevel() : nullptr;
+	if (!Level || Level->IsPersistentLevel() || Enemy->IsPooled() || !IsServerWorld())
+	{
+		return false;
+	}
+
+	const FName CellKey = GetCellKey(Level);
+	TMap<uint32, FEnemyPersistedState>* Placed = DecodedCells.Find(CellKey);
+	if (!Placed)
+	{
+		const FCellRecord* Record = Cells.Find(CellKey);
+		if (!Record || Record->NumPlaced == 0)
+		{
+			return false;
+		}
+
+		// 셀의 첫 번째 적에서 한 번만 풀어 둠
+		Placed = &DecodedCells.Add(CellKey);
+		DecodeRecord(*Record, Placed, nullptr);
+	}
+
+	const FEnemyPersistedState* State = Placed->Find(GetEnemyKey(Enemy));
+	if (!State)
+	{
+		return false;
+	}
+
+	OutState = *State;
+	++(OutState.bIsDead ? NumSkippedDead : NumRestored);
+	return true;
+}
+
+void UEnemyPersistenceSubsystem::CaptureEnemy(const ABaseEnemy* Enemy, EEndPlayReason::Type EndPlayReason)
+{
+	if (EndPlayReason != EEndPlayReason::RemovedFromWorld && EndPlayReason != EEndPlayReason::Destroyed)
+	{
+		return;
+	}
+
+	const ULevel* Level = Enemy ? Enemy->GetLevel() : nullptr;
+	if (!Level || Level->IsPersistentLevel() || Enemy->IsPooled() || !IsServerWorld())
+	{
+		return;
+	}
+
+	// 셀이 살아 있는 동안 삭제된 배치 적은 다시 로드돼도 나오지 않아야 함
+	FEnemyPersistedState State = MakeState(Enemy);
+	State.bIsDead |= EndPlayReason == EEndPlayReason::Destroyed;
+
+	CapturedCells.FindOrAdd(GetCellKey(Level)).Add(GetEnemyKey(Enemy), State);
+}
+
+void UEnemyPersistenceSubsystem::HandleLevelRemoved(ULevel* InLevel, UWorld* InWorld)
+{
+	// 레벨이 nullptr이면 월드 전체 정리 중
+	if (!InLevel || InWorld != GetWorld() || InLevel->IsPersistentLevel() || !IsServerWorld())
+	{
+		return;
+	}
+
+	const FName CellKey = GetCellKey(InLevel);
+	FCellRecord& Record = Cells.FindOrAdd(CellKey);
+	DecodedCells.Remove(CellKey);
+
+	// 기존 레코드에 이번에 모은 배치 적 상태를 덮어쓰고 셀 범위의 런타임 적을 더함
+	TMap<uint32, FEnemyPersistedState> Placed;
+	TArray<FEnemyPersistedState> Runtime;
+	DecodeRecord(Record, &Placed, &Runtime);
+
+	TMap<uint32, FEnemyPersistedState> Captured;
+	if (CapturedCells.RemoveAndCopyValue(CellKey, Captured))
+	{
+		Placed.Append(MoveTemp(Captured));
+	}
+
+	// 아직 스폰되지 않은 재스폰 요청은 언로드된 셀에 나오지 않도록 취소하고 레코드로 되돌림
+	CancelPendingRespawns(CellKey, Runtime);
+
+	if (bPersistRuntimeEnemies && Record.Bounds.IsValid)
+	{
+		StashRuntimeEnemies(Record.Bounds, Runtime);
+	}
+
+	EncodeRecord(Placed, Runtime, Record);
+}
+
+void UEnemyPersistenceSubsystem::HandleLevelAdded(ULevel* InLevel, UWorld* InWorld)
+{
+	if (!InLevel || InWorld != GetWorld() || InLevel->IsPersistentLevel() || !IsServerWorld())
+	{
+		return;
+	}
+
+	// 셀의 BeginPlay는 이 알림 전에 끝나므로 풀어 둔 배치 적 상태는 더 필요 없음
+	const FName CellKey = GetCellKey(InLevel);
+	DecodedCells.Remove(CellKey);
+
+	FCellRecord* Record = Cells.Find(CellKey);
+	if (bPersistRuntimeEnemies && !Record)
+	{
+		Record = &Cells.Add(CellKey);
+	}
+	if (!Record)
+	{
+		return;
+	}
+
+	// 언로드될 때 어느 런타임 적을 함께 보낼지 정하는 범위
+	if (!Record->Bounds.IsValid)
+	{
+		Record->Bounds = ALevelBounds::CalculateLevelBounds(InLevel);
+	}
+
+	if (Record->NumRuntime > 0)
+	{
+		TMap<uint32, FEnemyPersistedState> Placed;
+		TArray<FEnemyPersistedState> Runtime;
+		DecodeRecord(*Record, &Placed, &Runtime);
+		RespawnRuntimeEnemies(CellKey, Runtime);
+
+		// 다시 스폰한 적은 레코드에서 뺌 (다음 언로드 때 다시 모으거나 남은 요청을 취소해 되돌림)
+		EncodeRecord(Placed, TArray<FEnemyPersistedState>(), *Record);
+	}
+}
+
+void UEnemyPersistenceSubsystem::StashRuntimeEnemies(const FBox& Bounds, TArray<FEnemyPersistedState>& OutRuntime)
+{
+	UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this);
+	UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this);
+	if (!Registry || !Pool)
+	{
+		return;
+	}
+
+	// 반납하면 레지스트리 배열이 바뀌므로 먼저 모음
+	TArray<ABaseEnemy*, TInlineAllocator<32>> ToStash;
+	for (ABaseEnemy* Enemy : Registry->GetRegisteredEnemies())
+	{
+		if (!Enemy || !Enemy->IsPooled() || Enemy->IsInPool() || !Enemy->IsAlive() || Enemy->GetTarget())
+		{
+			continue;
+		}
+
+		const EEnemyState State = Enemy->GetCurrentState();
+		if ((State == EEnemyState::Idle || State == EEnemyState::Patrolling) && Bounds.IsInsideXY(Enemy->GetActorLocation()))
+		{
+			ToStash.Add(Enemy);
+		}
+	}
+
+	for (ABaseEnemy* Enemy : ToStash)
+	{
+		FEnemyPersistedState& State = OutRuntime.Add_GetRef(MakeState(Enemy));
+		State.EnemyClass = Enemy->GetClass();
+		Pool->ReleaseEnemy(Enemy);
+	}
+	NumStashed += ToStash.Num();
+}
+
+void UEnemyPersistenceSubsystem::RespawnRuntimeEnemies(FName CellKey, const TArray<FEnemyPersistedState>& Runtime)
+{
+	UEnemySpawnSubsystem* Spawner = UEnemySpawnSubsystem::Get(this);
+	if (!Spawner)
+	{
+		return;
+	}
+
+	// 프레임 예산 안에서 나눠 스폰되고 완료 시 HandleSpawnCompleted에서 상태를 복원
+	for (const FEnemyPersistedState& State : Runtime)
+	{
+		const FTransform SpawnTransform(FRotator(0.0f, State.Yaw, 0.0f), State.Location + FVector(0.0f, 0.0f, RespawnHeightOffset));
+		const int32 RequestId = Spawner->RequestSpawn(State.EnemyClass, SpawnTransform);
+		if (RequestId != INDEX_NONE)
+		{
+			PendingRespawns.Add(RequestId, { CellKey, State });
+		}
+	}
+}
+
+void UEnemyPersistenceSubsystem::CancelPendingRespawns(FName CellKey, TArray<FEnemyPersistedState>& OutRuntime)
+{
+	UEnemySpawnSubsystem* Spawner = UEnemySpawnSubsystem::Get(this);
+	if (!Spawner)
+	{
+		return;
+	}
+
+	for (auto It = PendingRespawns.CreateIterator(); It; ++It)
+	{
+		// 이미 스폰된 요청은 완료 알림에서 정리됨
+		if (It.Value().CellKey == CellKey && Spawner->CancelSpawn(It.Key()))
+		{
+			OutRuntime.Add(It.Value().State);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UEnemyPersistenceSubsystem::HandleSpawnCompleted(const FEnemySpawnResult& Result)
+{
+	FPendingRespawn Respawn;
+	if (!PendingRespawns.RemoveAndCopyValue(Result.RequestId, Respawn) || !Result.Enemy)
+	{
+		return;
+	}
+
+	Result.Enemy->ApplyPersistedState(Respawn.State);
+	++NumRespawned;
+}
+
+void UEnemyPersistenceSubsystem::EncodeRecord(const TMap<uint32, FEnemyPersistedState>& Placed, const TArray<FEnemyPersistedState>& Runtime, FCellRecord& OutRecord)
+{
+	OutRecord.Bytes.Reset();
+	OutRecord.NumPlaced = FMath::Min(Placed.Num(), (int32)MAX_uint16);
+	OutRecord.NumRuntime = 0;
+	if (Placed.Num() == 0 && Runtime.Num() == 0)
+	{
+		OutRecord.NumPlaced = 0;
+		OutRecord.Bytes.Shrink();
+		return;
+	}
+
+	// 런타임 적의 클래스 경로는 레코드 앞에 한 번씩만 쓰고 적마다 인덱스로 참조
+	TArray<FSoftObjectPath, TInlineAllocator<8>> ClassPaths;
+	TArray<uint8, TInlineAllocator<64>> ClassIndices;
+	for (const FEnemyPersistedState& State : Runtime)
+	{
+		const int32 ClassIndex = ClassPaths.AddUnique(State.EnemyClass.ToSoftObjectPath());
+		ClassIndices.Add((uint8)FMath::Min(ClassIndex, (int32)MAX_uint8));
+	}
+	OutRecord.NumRuntime = FMath::Min(Runtime.Num(), (int32)MAX_uint16);
+
+	FMemoryWriter Writer(OutRecord.Bytes);
+	uint8 Version = EnemyPersistence::RecordVersion;
+	uint16 NumPlaced = (uint16)OutRecord.NumPlaced;
+	uint16 NumRuntime = (uint16)OutRecord.NumRuntime;
+	uint8 NumClasses = (uint8)FMath::Min(ClassPaths.Num(), (int32)MAX_uint8);
+	Writer << Version << NumPlaced << NumRuntime << NumClasses;
+
+	for (int32 Index = 0; Index < NumClasses; ++Index)
+	{
+		FString ClassPath = ClassPaths[Index].ToString();
+		Writer << ClassPath;
+	}
+
+	// 배치 적: 이름 해시(4) + 상태(1) + 체력(2) + 위치(12) + Yaw(2) = 21바이트
+	int32 NumWritten = 0;
+	for (const TPair<uint32, FEnemyPersistedState>& Pair : Placed)
+	{
+		if (NumWritten++ >= NumPlaced)
+		{
+			break;
+		}
+
+		uint32 Key = Pair.Key;
+		FEnemyPersistedState State = Pair.Value;
+		Writer << Key;
+		EnemyPersistence::SerializeCommon(Writer, State);
+	}
+
+	// 런타임 적: 클래스(1) + 레벨(1) + 등급(1) + 공통(17) = 20바이트
+	for (int32 Index = 0; Index < NumRuntime; ++Index)
+	{
+		FEnemyPersistedState State = Runtime[Index];
+		uint8 ClassIndex = ClassIndices[Index];
+		uint8 EnemyLevel = (uint8)FMath::Clamp(State.Level, 0, (int32)MAX_uint8);
+		uint8 Rank = (uint8)State.Rank;
+		Writer << ClassIndex << EnemyLevel << Rank;
+		EnemyPersistence::SerializeCommon(Writer, State);
+	}
+
+	OutRecord.Bytes.Shrink();
+}
+
+void UEnemyPersistenceSubsystem::DecodeRecord(const FCellRecord& Record, TMap<uint32, FEnemyPersistedState>* OutPlaced, TArray<FEnemyPersistedState>* OutRuntime)
+{
+	if (Record.Bytes.Num() == 0)
+	{
+		return;
+	}
+
+	FMemoryReader Reader(Record.Bytes);
+	uint8 Version = 0;
+	uint16 NumPlaced = 0;
+	uint16 NumRuntime = 0;
+	uint8 NumClasses = 0;
+	Reader << Version << NumPlaced << NumRuntime << NumClasses;
+	if (Version != EnemyPersistence::RecordVersion)
+	{
+		return;
+	}
+
+	TArray<TSoftClassPtr<ABaseEnemy>, TInlineAllocator<8>> Classes;
+	for (int32 Index = 0; Index < NumClasses; ++Index)
+	{
+		FString ClassPath;
+		Reader << ClassPath;
+		Classes.Add(TSoftClassPtr<ABaseEnemy>(FSoftObjectPath(ClassPath)));
+	}
+
+	if (OutPlaced)
+	{
+		OutPlaced->Reserve(OutPlaced->Num() + NumPlaced);
+	}
+	for (int32 Index = 0; Index < NumPlaced && !Reader.IsError(); ++Index)
+	{
+		uint32 Key = 0;
+		FEnemyPersistedState State;
+		Reader << Key;
+		EnemyPersistence::SerializeCommon(Reader, State);
+		if (OutPlaced)
+		{
+			OutPlaced->Add(Key, State);
+		}
+	}
+
+	// 런타임 적은 필요할 때만 읽음
+	if (!OutRuntime)
+	{
+		return;
+	}
+
+	OutRuntime->Reserve(OutRuntime->Num() + NumRuntime);
+	for (int32 Index = 0; Index < NumRuntime && !Reader.IsError(); ++Index)
+	{
+		uint8 ClassIndex = 0;
+		uint8 EnemyLevel = 0;
+		uint8 Rank = 0;
+		FEnemyPersistedState State;
+		Reader << ClassIndex << EnemyLevel << Rank;
+		EnemyPersistence::SerializeCommon(Reader, State);
+
+		if (Classes.IsValidIndex(ClassIndex))
+		{
+			State.EnemyClass = Classes[ClassIndex];
+			State.Level = EnemyLevel;
+			State.Rank = (EEnemyRank)Rank;
+			OutRuntime->Add(State);
+		}
+	}
+}
+
+int32 UEnemyPersistenceSubsystem::GetNumPersistedBytes() const
+{
+	int32 NumBytes = 0;
+	for (const TPair<FName, FCellRecord>& Pair : Cells)
+	{
+		NumBytes += Pair.Value.Bytes.Num();
+	}
+	return NumBytes;
+}
+
+FString UEnemyPersistenceSubsystem::GetStatsString() const
+{
+	int32 NumPlaced = 0;
+	int32 NumRuntime = 0;
+	for (const TPair<FName, FCellRecord>& Pair : Cells)
+	{
+		NumPlaced += Pair.Value.NumPlaced;
+		NumRuntime += Pair.Value.NumRuntime;
+	}
+
+	return FString::Printf(TEXT("Enemy Persistence - Cells: %d, Records: %d placed / %d runtime, %d bytes, Restored: %d (dead skipped %d), Stashed: %d, Respawned: %d (pending %d)"),
+		Cells.Num(), NumPlaced, NumRuntime, GetNumPersistedBytes(), NumRestored, NumSkippedDead, NumStashed, NumRespawned, PendingRespawns.Num());
+}
@@ -0,0 +1,130 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BaseEnemy.h"
+#include "EnemyPersistenceSubsystem.generated.h"
+
+struct FEnemySpawnResult;
+
+// 셀이 언로드된 동안 보존되는 적 하나의 상태
+struct FEnemyPersistedState
+{
+	FVector Location = FVector::ZeroVector;
+	float Yaw = 0.0f;
+
+	EEnemyState State = EEnemyState::Idle;
+	float HealthFraction = 1.0f;
+	bool bIsDead = false;
+
+	// 런타임에 스폰된 적만 사용 (배치된 적은 레벨이 다시 생성함)
+	TSoftClassPtr<ABaseEnemy> EnemyClass;
+	int32 Level = 1;
+	EEnemyRank Rank = EEnemyRank::Normal;
+};
+
+/**
+ * 스트리밍 셀(World Partition 셀/스트리밍 레벨)이 언로드될 때 그 안의 적 상태를 셀별 바이너리 레코드로 보존하는 서브시스템
+ * 배치된 적은 EndPlay에서 위치/체력/상태/사망 여부를 모아 두었다가 셀이 빠질 때 적 하나당 21바이트로 압축하고,
+ * 셀이 다시 로드되면 BeginPlay에서 레코드를 찾아 그대로 이어받는다. 죽은 적은 초기화 없이 바로 제거하지만,
+ * 살아 있는 적은 레벨이 새로 만든 액터이므로 평소처럼 InitializeStats/InitializeAI를 거친 뒤 상태를 덮어쓴다.
+ * 셀 범위 안에서 한가하게 서 있던 런타임 스폰 적(풀 소속)은 셀과 함께 풀로 돌려보내고, 셀이 다시 로드되면
+ * UEnemySpawnSubsystem으로 다시 스폰해 상태를 복원한다. 스폰이 끝나기 전에 셀이 다시 언로드되면 남은 요청을
+ * 취소하고 레코드로 되돌린다. 언로드된 셀의 적은 액터/Tick 없이 레코드로만 남는다.
+ * 레코드는 메모리에만 있으므로 세션(월드)이 끝나면 사라진다.
+ */
+UCLASS(config=Game)
+class LOGIC_API UEnemyPersistenceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	static UEnemyPersistenceSubsystem* Get(const UObject* WorldContextObject);
+
+	// 배치된 적이 BeginPlay에서 호출: 셀에 저장된 상태가 있으면 true
+	bool FindPersistedState(const ABaseEnemy* Enemy, FEnemyPersistedState& OutState);
+
+	// 배치된 적이 EndPlay에서 호출: 셀 언로드(RemovedFromWorld)면 현재 상태를, 삭제(Destroyed)면 사망으로 기록
+	void CaptureEnemy(const ABaseEnemy* Enemy, EEndPlayReason::Type EndPlayReason);
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Persistence")
+	int32 GetNumPersistedBytes() const;
+
+	FString GetStatsString() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 셀이 언로드될 때 이 상태인 풀 소속 적만 레코드로 보냄 (전투 중인 적은 플레이어 곁에 남김)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Persistence")
+	bool bPersistRuntimeEnemies = true;
+
+	// 다시 로드된 셀에서 적을 복원할 때 이 높이만큼 띄워 스폰 (바닥에 끼지 않도록)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Persistence")
+	float RespawnHeightOffset = 10.0f;
+
+private:
+	// 셀 하나의 압축 레코드와 마지막으로 로드됐을 때의 범위
+	struct FCellRecord
+	{
+		TArray<uint8> Bytes;
+		FBox Bounds = FBox(ForceInit);
+		int32 NumPlaced = 0;
+		int32 NumRuntime = 0;
+	};
+
+	void HandleLevelAdded(ULevel* InLevel, UWorld* InWorld);
+	void HandleLevelRemoved(ULevel* InLevel, UWorld* InWorld);
+	void HandleSpawnCompleted(const FEnemySpawnResult& Result);
+
+	// 셀 범위 안의 한가한 런타임 적을 상태로 바꾸고 풀에 반납
+	void StashRuntimeEnemies(const FBox& Bounds, TArray<FEnemyPersistedState>& OutRuntime);
+	void RespawnRuntimeEnemies(FName CellKey, const TArray<FEnemyPersistedState>& Runtime);
+
+	// 아직 스폰되지 않은 셀의 재스폰 요청을 취소하고 상태를 되돌려 받음
+	void CancelPendingRespawns(FName CellKey, TArray<FEnemyPersistedState>& OutRuntime);
+
+	bool IsServerWorld() const;
+
+	static FName GetCellKey(const ULevel* Level);
+	static uint32 GetEnemyKey(const ABaseEnemy* Enemy);
+	static FEnemyPersistedState MakeState(const ABaseEnemy* Enemy);
+
+	static void EncodeRecord(const TMap<uint32, FEnemyPersistedState>& Placed, const TArray<FEnemyPersistedState>& Runtime, FCellRecord& OutRecord);
+	static void DecodeRecord(const FCellRecord& Record, TMap<uint32, FEnemyPersistedState>* OutPlaced, TArray<FEnemyPersistedState>* OutRuntime);
+
+	// 언로드된(또는 한 번 이상 언로드됐던) 셀의 레코드
+	TMap<FName, FCellRecord> Cells;
+
+	// 로드된 셀에서 EndPlay로 모은 상태 (셀이 언로드될 때 레코드에 합침)
+	TMap<FName, TMap<uint32, FEnemyPersistedState>> CapturedCells;
+
+	// 로드 중인 셀의 레코드를 한 번만 풀어 둔 것 (셀의 BeginPlay가 끝나면 버림)
+	TMap<FName, TMap<uint32, FEnemyPersistedState>> DecodedCells;
+
+	// 다시 스폰 중인 런타임 적 하나
+	struct FPendingRespawn
+	{
+		FName CellKey;
+		FEnemyPersistedState State;
+	};
+
+	// 스폰 요청 ID → 요청한 셀과 복원할 상태
+	TMap<int32, FPendingRespawn> PendingRespawns;
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle SpawnCompletedHandle;
+
+	// === 통계 ===
+	int32 NumRestored = 0;
+	int32 NumSkippedDead = 0;
+	int32 NumStashed = 0;
+	int32 NumRespawned = 0;
+};
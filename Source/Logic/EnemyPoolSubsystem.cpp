@@ -0,0 +1,177 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyPoolSubsystem.h"
+#include "BaseEnemy.h"
+#include "LogicMemory.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorld GEnemyPoolStatsCommand(
+	TEXT("Logic.EnemyPool.Stats"),
+	TEXT("적 풀의 클래스별 hit/miss 통계를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(World))
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *Pool->GetStatsString());
+		}
+	}));
+
+UEnemyPoolSubsystem* UEnemyPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemyPoolSubsystem>() : nullptr;
+}
+
+bool UEnemyPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyPoolSubsystem::Deinitialize()
+{
+	Buckets.Empty();
+
+	Super::Deinitialize();
+}
+
+ABaseEnemy* UEnemyPoolSubsystem::AcquireEnemy(TSubclassOf<ABaseEnemy> EnemyClass, const FTransform& SpawnTransform)
+{
+	if (!EnemyClass)
+	{
+		return nullptr;
+	}
+
+	FEnemyPoolBucket& Bucket = Buckets.FindOrAdd(EnemyClass);
+
+	// 대기 중인 적 재사용
+	while (Bucket.FreeEnemies.Num() > 0)
+	{
+		ABaseEnemy* Enemy = Bucket.FreeEnemies.Pop(EAllowShrinking::No);
+		if (!IsValid(Enemy))
+		{
+			continue;
+		}
+
+		Enemy->SetActorLocationAndRotation(SpawnTransform.GetLocation(), SpawnTransform.GetRotation(), false, nullptr, ETeleportType::ResetPhysics);
+		Enemy->ResetForReuse();
+
+		++Bucket.Stats.Hits;
+		++Bucket.Stats.NumActive;
+		Bucket.Stats.NumFree = Bucket.FreeEnemies.Num();
+		return Enemy;
+	}
+
+	// 풀이 비어 있으면 새로 생성
+	ABaseEnemy* Enemy = SpawnPooledEnemy(EnemyClass, SpawnTransform);
+	if (Enemy)
+	{
+		++Bucket.Stats.Misses;
+		++Bucket.Stats.NumActive;
+	}
+	return Enemy;
+}
+
+void UEnemyPoolSubsystem::ReleaseEnemy(ABaseEnemy* Enemy)
+{
+	if (!IsValid(Enemy) || Enemy->IsInPool())
+	{
+		return;
+	}
+
+	Enemy->DeactivateForPool();
+
+	FEnemyPoolBucket& Bucket = Buckets.FindOrAdd(Enemy->GetClass());
+	Bucket.FreeEnemies.Add(Enemy);
+	++Bucket.Stats.Releases;
+	Bucket.Stats.NumActive = FMath::Max(0, Bucket.Stats.NumActive - 1);
+	Bucket.Stats.NumFree = Bucket.FreeEnemies.Num();
+}
+
+void UEnemyPoolSubsystem::WarmUp(TSubclassOf<ABaseEnemy> EnemyClass, int32 Count)
+{
+	if (!EnemyClass || Count <= 0)
+	{
+		return;
+	}
+
+	FEnemyPoolBucket& Bucket = Buckets.FindOrAdd(EnemyClass);
+	const int32 NumToSpawn = Count - Bucket.FreeEnemies.Num();
+
+	// 보이지 않는 곳에 생성 후 바로 비활성화
+	const FTransform HiddenTransform(FVector(0.0f, 0.0f, -100000.0f));
+	for (int32 Index = 0; Index < NumToSpawn; ++Index)
+	{
+		if (ABaseEnemy* Enemy = SpawnPooledEnemy(EnemyClass, HiddenTransform))
+		{
+			Enemy->DeactivateForPool();
+			Bucket.FreeEnemies.Add(Enemy);
+		}
+	}
+
+	Bucket.Stats.NumFree = Bucket.FreeEnemies.Num();
+}
+
+bool UEnemyPoolSubsystem::HasFreeEnemy(TSubclassOf<ABaseEnemy> EnemyClass) const
+{
+	const FEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass);
+	return Bucket && Bucket->FreeEnemies.Num() > 0;
+}
+
+FEnemyPoolStats UEnemyPoolSubsystem::GetPoolStats(TSubclassOf<ABaseEnemy> EnemyClass) const
+{
+	const FEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass);
+	return Bucket ? Bucket->Stats : FEnemyPoolStats();
+}
+
+void UEnemyPoolSubsystem::ForgetEnemy(ABaseEnemy* Enemy)
+{
+	if (!Enemy)
+	{
+		return;
+	}
+
+	if (FEnemyPoolBucket* Bucket = Buckets.Find(Enemy->GetClass()))
+	{
+		if (Bucket->FreeEnemies.RemoveSingleSwap(Enemy, EAllowShrinking::No) == 0)
+		{
+			// 사용 중이던 적이 파괴됨
+			Bucket->Stats.NumActive = FMath::Max(0, Bucket->Stats.NumActive - 1);
+		}
+		Bucket->Stats.NumFree = Bucket->FreeEnemies.Num();
+	}
+}
+
+FString UEnemyPoolSubsystem::GetStatsString() const
+{
+	FString Result = TEXT("Enemy Pool");
+	for (const TPair<TSubclassOf<ABaseEnemy>, FEnemyPoolBucket>& Pair : Buckets)
+	{
+		const FEnemyPoolStats& Stats = Pair.Value.Stats;
+		Result += FString::Printf(TEXT("\n  %s - Hits: %d, Misses: %d, Releases: %d, Free: %d, Active: %d"),
+			*GetNameSafe(Pair.Key), Stats.Hits, Stats.Misses, Stats.Releases, Stats.NumFree, Stats.NumActive);
+	}
+	return Result;
+}
+
+ABaseEnemy* UEnemyPoolSubsystem::SpawnPooledEnemy(TSubclassOf<ABaseEnemy> EnemyClass, const FTransform& SpawnTransform)
+{
+	LLM_SCOPE_BYTAG(Logic_Enemies);
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	ABaseEnemy* Enemy = World->SpawnActorDeferred<ABaseEnemy>(EnemyClass, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Enemy)
+	{
+		return nullptr;
+	}
+
+	// 죽었을 때 Destroy 대신 풀로 돌아오도록 표시
+	Enemy->SetPooled(true);
+	Enemy->FinishSpawning(SpawnTransform);
+	return Enemy;
+}
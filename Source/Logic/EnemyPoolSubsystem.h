@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyPoolSubsystem.generated.h"
+
+class ABaseEnemy;
+
+// 클래스별 풀 통계
+USTRUCT(BlueprintType)
+struct FEnemyPoolStats
+{
+	GENERATED_BODY()
+
+	// 풀에서 꺼내 재사용한 횟수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy Pool")
+	int32 Hits = 0;
+
+	// 풀이 비어서 새로 생성한 횟수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy Pool")
+	int32 Misses = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy Pool")
+	int32 Releases = 0;
+
+	// 현재 대기 중 / 사용 중인 수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy Pool")
+	int32 NumFree = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy Pool")
+	int32 NumActive = 0;
+};
+
+USTRUCT()
+struct FEnemyPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABaseEnemy>> FreeEnemies;
+
+	FEnemyPoolStats Stats;
+};
+
+/**
+ * 적 클래스별 오브젝트 풀
+ * 죽은 적을 Destroy하지 않고 비활성화해서 보관했다가 ResetForReuse로 다시 꺼내 쓴다.
+ * 레벨에 AEnemyPoolWarmupActor를 배치하면 시작 시 미리 생성해 둔다.
+ */
+UCLASS()
+class LOGIC_API UEnemyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	static UEnemyPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	// 풀에서 꺼내거나 (Hit) 없으면 새로 생성 (Miss)
+	UFUNCTION(BlueprintCallable, Category = "Enemy Pool")
+	ABaseEnemy* AcquireEnemy(TSubclassOf<ABaseEnemy> EnemyClass, const FTransform& SpawnTransform);
+
+	// 비활성화해서 풀에 반납
+	UFUNCTION(BlueprintCallable, Category = "Enemy Pool")
+	void ReleaseEnemy(ABaseEnemy* Enemy);
+
+	// Count개가 대기하도록 미리 생성
+	UFUNCTION(BlueprintCallable, Category = "Enemy Pool")
+	void WarmUp(TSubclassOf<ABaseEnemy> EnemyClass, int32 Count);
+
+	// 다음 AcquireEnemy가 새로 생성하지 않고 재사용할 수 있는지
+	bool HasFreeEnemy(TSubclassOf<ABaseEnemy> EnemyClass) const;
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Pool")
+	FEnemyPoolStats GetPoolStats(TSubclassOf<ABaseEnemy> EnemyClass) const;
+
+	// 풀 소속 적이 외부에서 파괴될 때 목록에서 제거
+	void ForgetEnemy(ABaseEnemy* Enemy);
+
+	FString GetStatsString() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	ABaseEnemy* SpawnPooledEnemy(TSubclassOf<ABaseEnemy> EnemyClass, const FTransform& SpawnTransform);
+
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<ABaseEnemy>, FEnemyPoolBucket> Buckets;
+};
@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyPoolWarmupActor.h"
+#include "EnemyPoolSubsystem.h"
+#include "BaseEnemy.h"
+
+AEnemyPoolWarmupActor::AEnemyPoolWarmupActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+}
+
+void AEnemyPoolWarmupActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 적은 서버가 스폰해 복제하므로 클라이언트는 미리 만들지 않음
+	// (복제되지 않는 배치 액터는 클라이언트에서도 HasAuthority가 true이므로 넷 모드로 판단)
+	if (GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this);
+	if (!Pool)
+	{
+		return;
+	}
+
+	for (const TPair<TSubclassOf<ABaseEnemy>, int32>& Pair : WarmUpCounts)
+	{
+		Pool->WarmUp(Pair.Key, Pair.Value);
+	}
+}
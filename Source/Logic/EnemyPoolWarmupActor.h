@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "EnemyPoolWarmupActor.generated.h"
+
+class ABaseEnemy;
+
+/**
+ * 레벨에 배치해서 적 풀을 미리 채워두는 액터
+ * 웨이브 전투가 있는 레벨에서 클래스별 (예: BP_BasicSlime, BP_ScarecrowEnemy) 예열 수를 지정한다.
+ */
+UCLASS()
+class LOGIC_API AEnemyPoolWarmupActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AEnemyPoolWarmupActor();
+
+protected:
+	virtual void BeginPlay() override;
+
+	// 클래스별 미리 생성해 둘 개수
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Pool")
+	TMap<TSubclassOf<ABaseEnemy>, int32> WarmUpCounts;
+};
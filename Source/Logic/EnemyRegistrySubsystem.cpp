@@ -0,0 +1,240 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyRegistrySubsystem.h"
+#include "BaseEnemy.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+UEnemyRegistrySubsystem* UEnemyRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemyRegistrySubsystem>() : nullptr;
+}
+
+bool UEnemyRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyRegistrySubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	Locations.Empty();
+	Cells.Empty();
+	EnemyIndices.Empty();
+	Grid.Empty();
+	Players.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyRegistrySubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyRegistrySubsystem::Tick(float DeltaTime)
+{
+	// 이동한 적만 셀을 옮긴다 (위치 캐시는 매 프레임 갱신)
+	for (int32 Index = 0; Index < Enemies.Num(); ++Index)
+	{
+		const ABaseEnemy* Enemy = Enemies[Index];
+		if (!Enemy)
+		{
+			continue;
+		}
+
+		const FVector NewLocation = Enemy->GetActorLocation();
+		Locations[Index] = NewLocation;
+
+		const FIntPoint NewCell = ToCell(NewLocation);
+		if (NewCell != Cells[Index])
+		{
+			RemoveFromCell(Cells[Index], Index);
+			AddToCell(NewCell, Index);
+			Cells[Index] = NewCell;
+		}
+	}
+}
+
+bool UEnemyRegistrySubsystem::GetCachedLocation(const ABaseEnemy* Enemy, FVector& OutLocation) const
+{
+	const int32* Index = EnemyIndices.Find(Enemy);
+	if (!Index)
+	{
+		return false;
+	}
+
+	OutLocation = Locations[*Index];
+	return true;
+}
+
+void UEnemyRegistrySubsystem::RegisterEnemy(ABaseEnemy* Enemy)
+{
+	if (!Enemy || EnemyIndices.Contains(Enemy))
+	{
+		return;
+	}
+
+	const FVector Location = Enemy->GetActorLocation();
+	const FIntPoint Cell = ToCell(Location);
+
+	const int32 Index = Enemies.Add(Enemy);
+	Locations.Add(Location);
+	Cells.Add(Cell);
+	EnemyIndices.Add(Enemy, Index);
+	AddToCell(Cell, Index);
+}
+
+void UEnemyRegistrySubsystem::UnregisterEnemy(ABaseEnemy* Enemy)
+{
+	int32 Index = INDEX_NONE;
+	if (!EnemyIndices.RemoveAndCopyValue(Enemy, Index))
+	{
+		return;
+	}
+
+	RemoveFromCell(Cells[Index], Index);
+
+	// 마지막 원소를 빈 자리로 옮기고 셀의 인덱스도 함께 고친다
+	const int32 LastIndex = Enemies.Num() - 1;
+	if (Index != LastIndex)
+	{
+		ABaseEnemy* Moved = Enemies[LastIndex];
+		RemoveFromCell(Cells[LastIndex], LastIndex);
+		AddToCell(Cells[LastIndex], Index);
+		EnemyIndices.Add(Moved, Index);
+	}
+
+	Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Locations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Cells.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void UEnemyRegistrySubsystem::RegisterPlayer(APawn* Player)
+{
+	if (Player)
+	{
+		Players.AddUnique(Player);
+	}
+}
+
+void UEnemyRegistrySubsystem::UnregisterPlayer(APawn* Player)
+{
+	Players.RemoveSingleSwap(Player, EAllowShrinking::No);
+}
+
+template <typename VisitorType>
+void UEnemyRegistrySubsystem::ForEachInBounds(const FVector& Origin, float Radius, VisitorType&& Visitor) const
+{
+	const FIntPoint MinCell = ToCell(Origin - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxCell = ToCell(Origin + FVector(Radius, Radius, 0.0f));
+
+	const int64 NumCellsInBounds = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+	// 검색 범위가 채워진 셀 수보다 크면 채워진 셀만 훑는 편이 싸다
+	if (NumCellsInBounds > Grid.Num())
+	{
+		for (const TPair<FIntPoint, TArray<int32>>& Pair : Grid)
+		{
+			if (Pair.Key.X < MinCell.X || Pair.Key.X > MaxCell.X || Pair.Key.Y < MinCell.Y || Pair.Key.Y > MaxCell.Y)
+			{
+				continue;
+			}
+			for (int32 Index : Pair.Value)
+			{
+				Visitor(Index);
+			}
+		}
+		return;
+	}
+
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			if (const TArray<int32>* Bucket = Grid.Find(FIntPoint(X, Y)))
+			{
+				for (int32 Index : *Bucket)
+				{
+					Visitor(Index);
+				}
+			}
+		}
+	}
+}
+
+void UEnemyRegistrySubsystem::QueryRadius(const FVector& Origin, float Radius, TArray<ABaseEnemy*>& OutEnemies) const
+{
+	const float RadiusSquared = FMath::Square(Radius);
+
+	ForEachInBounds(Origin, Radius, [&](int32 Index)
+	{
+		if (FVector::DistSquared(Origin, Locations[Index]) <= RadiusSquared)
+		{
+			OutEnemies.Add(Enemies[Index]);
+		}
+	});
+}
+
+void UEnemyRegistrySubsystem::QueryCone(const FVector& Origin, const FVector& Direction, float HalfAngleDegrees, float Radius, TArray<ABaseEnemy*>& OutEnemies) const
+{
+	const float RadiusSquared = FMath::Square(Radius);
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(HalfAngleDegrees));
+	const FVector Forward = Direction.GetSafeNormal();
+
+	ForEachInBounds(Origin, Radius, [&](int32 Index)
+	{
+		const FVector ToEnemy = Locations[Index] - Origin;
+		const float DistanceSquared = ToEnemy.SizeSquared();
+		if (DistanceSquared > RadiusSquared)
+		{
+			return;
+		}
+
+		// acos 대신 내적을 cos(반각)과 비교 (정규화 없이 |v|를 곱해서 비교)
+		const float Dot = FVector::DotProduct(Forward, ToEnemy);
+		if (Dot >= CosHalfAngle * FMath::Sqrt(DistanceSquared))
+		{
+			OutEnemies.Add(Enemies[Index]);
+		}
+	});
+}
+
+TArray<ABaseEnemy*> UEnemyRegistrySubsystem::GetEnemiesInRadius(const FVector& Origin, float Radius) const
+{
+	TArray<ABaseEnemy*> Result;
+	QueryRadius(Origin, Radius, Result);
+	return Result;
+}
+
+TArray<ABaseEnemy*> UEnemyRegistrySubsystem::GetEnemiesInCone(const FVector& Origin, const FVector& Direction, float HalfAngleDegrees, float Radius) const
+{
+	TArray<ABaseEnemy*> Result;
+	QueryCone(Origin, Direction, HalfAngleDegrees, Radius, Result);
+	return Result;
+}
+
+FIntPoint UEnemyRegistrySubsystem::ToCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UEnemyRegistrySubsystem::AddToCell(const FIntPoint& Cell, int32 DenseIndex)
+{
+	Grid.FindOrAdd(Cell).Add(DenseIndex);
+}
+
+void UEnemyRegistrySubsystem::RemoveFromCell(const FIntPoint& Cell, int32 DenseIndex)
+{
+	if (TArray<int32>* Bucket = Grid.Find(Cell))
+	{
+		Bucket->RemoveSingleSwap(DenseIndex, EAllowShrinking::No);
+		if (Bucket->Num() == 0)
+		{
+			Grid.Remove(Cell);
+		}
+	}
+}
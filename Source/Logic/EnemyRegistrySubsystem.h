@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyRegistrySubsystem.generated.h"
+
+class ABaseEnemy;
+class APawn;
+
+/**
+ * 월드에 살아있는 적 목록을 관리하는 서브시스템
+ * 균일 그리드(XY 평면)로 적 위치를 버킷팅해서 반경/원뿔 검색을 선형 탐색 없이 처리한다.
+ * 적은 BeginPlay에서 등록되고 Die/EndPlay에서 해제된다.
+ */
+UCLASS()
+class LOGIC_API UEnemyRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// === USubsystem ===
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemyRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	// === 등록 ===
+	void RegisterEnemy(ABaseEnemy* Enemy);
+	void UnregisterEnemy(ABaseEnemy* Enemy);
+	bool IsRegistered(const ABaseEnemy* Enemy) const { return EnemyIndices.Contains(Enemy); }
+
+	// 이번 프레임에 캐시된 위치 (등록되지 않았으면 false). 네트워크 관련성 판정 등에서 사용
+	bool GetCachedLocation(const ABaseEnemy* Enemy, FVector& OutLocation) const;
+
+	// === 검색 ===
+	// Origin 기준 Radius 안의 적 (3D 거리 기준)
+	void QueryRadius(const FVector& Origin, float Radius, TArray<ABaseEnemy*>& OutEnemies) const;
+
+	// Origin에서 Direction 방향으로 HalfAngleDegrees 이내, Radius 안의 적
+	void QueryCone(const FVector& Origin, const FVector& Direction, float HalfAngleDegrees, float Radius, TArray<ABaseEnemy*>& OutEnemies) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Enemy Registry")
+	TArray<ABaseEnemy*> GetEnemiesInRadius(const FVector& Origin, float Radius) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Enemy Registry")
+	TArray<ABaseEnemy*> GetEnemiesInCone(const FVector& Origin, const FVector& Direction, float HalfAngleDegrees, float Radius) const;
+
+	// 등록된 전체 적 (연속 배열, 순서 보장 안 됨)
+	const TArray<TObjectPtr<ABaseEnemy>>& GetRegisteredEnemies() const { return Enemies; }
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Registry")
+	int32 GetNumRegisteredEnemies() const { return Enemies.Num(); }
+
+	// === 플레이어 ===
+	// 적 AI가 상대하는 플레이어 폰 (보통 1~4명이므로 선형 배열)
+	void RegisterPlayer(APawn* Player);
+	void UnregisterPlayer(APawn* Player);
+	const TArray<TObjectPtr<APawn>>& GetRegisteredPlayers() const { return Players; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 그리드 셀 한 변의 길이 (언리얼 단위)
+	UPROPERTY(EditAnywhere, Category = "Enemy Registry")
+	float CellSize = 500.0f;
+
+private:
+	FIntPoint ToCell(const FVector& Location) const;
+	void AddToCell(const FIntPoint& Cell, int32 DenseIndex);
+	void RemoveFromCell(const FIntPoint& Cell, int32 DenseIndex);
+
+	// 셀 범위를 순회하며 Visitor(DenseIndex)를 호출
+	template <typename VisitorType>
+	void ForEachInBounds(const FVector& Origin, float Radius, VisitorType&& Visitor) const;
+
+	// === 연속 배열 (같은 인덱스 = 같은 적) ===
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABaseEnemy>> Enemies;
+
+	TArray<FVector> Locations;
+	TArray<FIntPoint> Cells;
+
+	// 적 -> 연속 배열 인덱스
+	TMap<const ABaseEnemy*, int32> EnemyIndices;
+
+	// 셀 -> 연속 배열 인덱스 목록
+	TMap<FIntPoint, TArray<int32>> Grid;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<APawn>> Players;
+};
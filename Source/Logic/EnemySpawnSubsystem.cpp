@@ -0,0 +1,239 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemySpawnSubsystem.h"
+#include "BaseEnemy.h"
+#include "EnemyPoolSubsystem.h"
+#include "LogicStats.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorld GEnemySpawnStatsCommand(
+	TEXT("Logic.EnemySpawn.Stats"),
+	TEXT("스폰 큐 길이, 생성/재사용 수와 스폰 지연 시간을 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UEnemySpawnSubsystem* Spawner = UEnemySpawnSubsystem::Get(World))
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *Spawner->GetStatsString());
+		}
+	}));
+
+UEnemySpawnSubsystem* UEnemySpawnSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemySpawnSubsystem>() : nullptr;
+}
+
+bool UEnemySpawnSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UEnemySpawnSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemySpawnSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemySpawnSubsystem::Deinitialize()
+{
+	// 로드 중인 요청은 취소, 끝난 것은 참조 해제
+	for (TPair<FSoftObjectPath, FClassLoadState>& Pair : ClassLoads)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			if (Pair.Value.Handle->HasLoadCompleted())
+			{
+				Pair.Value.Handle->ReleaseHandle();
+			}
+			else
+			{
+				Pair.Value.Handle->CancelHandle();
+			}
+		}
+	}
+	ClassLoads.Empty();
+	Requests.Empty();
+	PendingResults.Empty();
+
+	Super::Deinitialize();
+}
+
+void UEnemySpawnSubsystem::PreloadEnemyClass(TSoftClassPtr<ABaseEnemy> EnemyClass)
+{
+	if (!EnemyClass.IsNull())
+	{
+		RequestClassLoad(EnemyClass);
+	}
+}
+
+bool UEnemySpawnSubsystem::IsEnemyClassLoaded(TSoftClassPtr<ABaseEnemy> EnemyClass) const
+{
+	return EnemyClass.Get() != nullptr;
+}
+
+UEnemySpawnSubsystem::FClassLoadState& UEnemySpawnSubsystem::RequestClassLoad(const TSoftClassPtr<ABaseEnemy>& EnemyClass)
+{
+	const FSoftObjectPath ClassPath = EnemyClass.ToSoftObjectPath();
+	FClassLoadState& State = ClassLoads.FindOrAdd(ClassPath);
+	if (State.Handle.IsValid() || State.bFailed)
+	{
+		return State;
+	}
+
+	// 이미 메모리에 있어도 핸들을 잡아서 웨이브 도중 언로드되지 않게 함 (이 경우 콜백은 바로 호출됨)
+	State.RequestTime = FPlatformTime::Seconds();
+	State.Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ClassPath,
+		FStreamableDelegate::CreateUObject(this, &UEnemySpawnSubsystem::HandleClassLoaded, ClassPath),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (!State.Handle.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UEnemySpawnSubsystem: 적 클래스 로드 요청 실패 - %s"), *ClassPath.ToString());
+		State.bFailed = true;
+	}
+	return State;
+}
+
+void UEnemySpawnSubsystem::HandleClassLoaded(FSoftObjectPath ClassPath)
+{
+	FClassLoadState* State = ClassLoads.Find(ClassPath);
+	if (!State)
+	{
+		return;
+	}
+
+	State->LoadedTime = FPlatformTime::Seconds();
+	if (!TSoftClassPtr<ABaseEnemy>(ClassPath).Get())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UEnemySpawnSubsystem: 적 클래스 로드 실패 - %s"), *ClassPath.ToString());
+		State->bFailed = true;
+	}
+}
+
+int32 UEnemySpawnSubsystem::RequestSpawn(TSoftClassPtr<ABaseEnemy> EnemyClass, const FTransform& SpawnTransform)
+{
+	if (EnemyClass.IsNull())
+	{
+		return INDEX_NONE;
+	}
+
+	RequestClassLoad(EnemyClass);
+
+	FSpawnRequest& Request = Requests.AddDefaulted_GetRef();
+	Request.Id = NextRequestId++;
+	Request.EnemyClass = EnemyClass;
+	Request.SpawnTransform = SpawnTransform;
+	Request.RequestTime = FPlatformTime::Seconds();
+	return Request.Id;
+}
+
+bool UEnemySpawnSubsystem::CancelSpawn(int32 RequestId)
+{
+	return Requests.RemoveAll([RequestId](const FSpawnRequest& Request) { return Request.Id == RequestId; }) > 0;
+}
+
+void UEnemySpawnSubsystem::Tick(float DeltaTime)
+{
+	CSV_CUSTOM_STAT(LogicCombat, SpawnQueue, Requests.Num(), ECsvCustomStatOp::Set);
+
+	UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this);
+	if (Requests.Num() == 0 || !Pool)
+	{
+		return;
+	}
+
+	LOGIC_COMBAT_SCOPE(STAT_LogicEnemySpawn);
+
+	// 1. 로드가 끝난 요청을 요청 순서대로, 생성/재사용 예산 안에서 스폰
+	int32 NumConstructions = 0;
+	int32 NumReuses = 0;
+	PendingResults.Reset();
+	for (int32 Index = 0; Index < Requests.Num();)
+	{
+		if (NumConstructions >= MaxConstructionsPerFrame && NumReuses >= MaxReusesPerFrame)
+		{
+			break;
+		}
+
+		const FSpawnRequest& Request = Requests[Index];
+		const FClassLoadState* LoadState = ClassLoads.Find(Request.EnemyClass.ToSoftObjectPath());
+		const TSubclassOf<ABaseEnemy> EnemyClass = Request.EnemyClass.Get();
+		if (!EnemyClass && !(LoadState && LoadState->bFailed))
+		{
+			// 아직 로드 중
+			++Index;
+			continue;
+		}
+
+		const bool bReuse = EnemyClass && Pool->HasFreeEnemy(EnemyClass);
+		if (EnemyClass && (bReuse ? NumReuses >= MaxReusesPerFrame : NumConstructions >= MaxConstructionsPerFrame))
+		{
+			++Index;
+			continue;
+		}
+
+		// 스폰 중 BeginPlay에서 새 요청이 들어와도 안전하도록 큐에서 먼저 뺌
+		FEnemySpawnResult& Result = PendingResults.AddDefaulted_GetRef();
+		Result.RequestId = Request.Id;
+		const double RequestTime = Request.RequestTime;
+		const double LoadedTime = LoadState ? LoadState->LoadedTime : 0.0;
+		const FTransform SpawnTransform = Request.SpawnTransform;
+		Requests.RemoveAt(Index, 1, EAllowShrinking::No);
+
+		if (EnemyClass)
+		{
+			++(bReuse ? NumReuses : NumConstructions);
+			Result.Enemy = Pool->AcquireEnemy(EnemyClass, SpawnTransform);
+			Result.bReusedFromPool = bReuse;
+		}
+
+		Result.LatencySeconds = (float)(FPlatformTime::Seconds() - RequestTime);
+		if (LoadedTime > 0.0)
+		{
+			Result.LoadSeconds = (float)FMath::Max(0.0, LoadedTime - RequestTime);
+		}
+	}
+
+	// 2. 통계 갱신 후 완료 알림 (콜백에서 새 요청을 넣어도 다음 프레임에 처리됨)
+	for (const FEnemySpawnResult& Result : PendingResults)
+	{
+		++NumCompleted;
+		if (!Result.Enemy)
+		{
+			++NumFailed;
+		}
+		else if (Result.bReusedFromPool)
+		{
+			++NumReused;
+		}
+		else
+		{
+			++NumConstructed;
+		}
+
+		AverageLatency = NumCompleted > 1 ? FMath::Lerp(AverageLatency, Result.LatencySeconds, 0.05f) : Result.LatencySeconds;
+		MaxLatency = FMath::Max(MaxLatency, Result.LatencySeconds);
+	}
+
+	for (const FEnemySpawnResult& Result : PendingResults)
+	{
+		OnEnemySpawnCompletedNative.Broadcast(Result);
+		OnEnemySpawnCompleted.Broadcast(Result);
+	}
+	PendingResults.Reset();
+}
+
+FString UEnemySpawnSubsystem::GetStatsString() const
+{
+	int32 NumLoading = 0;
+	for (const TPair<FSoftObjectPath, FClassLoadState>& Pair : ClassLoads)
+	{
+		NumLoading += (Pair.Value.LoadedTime == 0.0 && !Pair.Value.bFailed) ? 1 : 0;
+	}
+
+	return FString::Printf(TEXT("Enemy Spawn - Pending: %d, Classes: %d (loading %d), Completed: %d (constructed %d, reused %d, failed %d), Latency avg %.3fs, max %.3fs, Budget: %d new / %d reuse per frame"),
+		Requests.Num(), ClassLoads.Num(), NumLoading, NumCompleted, NumConstructed, NumReused, NumFailed,
+		AverageLatency, MaxLatency, MaxConstructionsPerFrame, MaxReusesPerFrame);
+}
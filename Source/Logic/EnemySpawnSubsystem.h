@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemySpawnSubsystem.generated.h"
+
+class ABaseEnemy;
+struct FStreamableHandle;
+
+// 스폰 요청 하나의 완료 결과
+USTRUCT(BlueprintType)
+struct FEnemySpawnResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Enemy Spawn")
+	int32 RequestId = INDEX_NONE;
+
+	// 클래스 로드 실패 시 nullptr
+	UPROPERTY(BlueprintReadOnly, Category = "Enemy Spawn")
+	TObjectPtr<ABaseEnemy> Enemy;
+
+	// 요청부터 스폰 완료까지 (초)
+	UPROPERTY(BlueprintReadOnly, Category = "Enemy Spawn")
+	float LatencySeconds = 0.0f;
+
+	// 그중 클래스 에셋 로드를 기다린 시간 (초)
+	UPROPERTY(BlueprintReadOnly, Category = "Enemy Spawn")
+	float LoadSeconds = 0.0f;
+
+	// 풀에서 재사용했으면 true, 새로 생성했으면 false
+	UPROPERTY(BlueprintReadOnly, Category = "Enemy Spawn")
+	bool bReusedFromPool = false;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEnemySpawnCompleted, const FEnemySpawnResult&, Result);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnEnemySpawnCompletedNative, const FEnemySpawnResult&);
+
+/**
+ * 적 스폰을 큐에 받아 프레임 예산 안에서 처리하는 서비스
+ * 적 클래스는 소프트 참조로 받아 스트리머블 매니저로 비동기 로드하고 (메시, 애님 BP, Behavior Tree 등 하드 참조 포함),
+ * 로드가 끝난 요청만 UEnemyPoolSubsystem으로 스폰한다. 새로 생성(액터 생성 + BeginPlay)은 프레임당 MaxConstructionsPerFrame,
+ * 풀 재사용은 MaxReusesPerFrame까지만 처리하고 나머지는 다음 프레임으로 넘긴다.
+ * 완료는 OnEnemySpawnCompleted로 지연 시간과 함께 알린다. 로드된 클래스는 서브시스템이 살아 있는 동안 유지된다.
+ */
+UCLASS(config=Game)
+class LOGIC_API UEnemySpawnSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemySpawnSubsystem* Get(const UObject* WorldContextObject);
+
+	// 웨이브 전에 미리 클래스 에셋을 비동기 로드
+	UFUNCTION(BlueprintCallable, Category = "Enemy Spawn")
+	void PreloadEnemyClass(TSoftClassPtr<ABaseEnemy> EnemyClass);
+
+	UFUNCTION(BlueprintCallable, Category = "Enemy Spawn")
+	bool IsEnemyClassLoaded(TSoftClassPtr<ABaseEnemy> EnemyClass) const;
+
+	// 스폰 요청을 큐에 넣고 요청 ID 반환 (완료는 OnEnemySpawnCompleted로 같은 ID와 함께 전달)
+	UFUNCTION(BlueprintCallable, Category = "Enemy Spawn")
+	int32 RequestSpawn(TSoftClassPtr<ABaseEnemy> EnemyClass, const FTransform& SpawnTransform);
+
+	// 아직 처리되지 않은 요청 취소 (이미 완료됐으면 false)
+	UFUNCTION(BlueprintCallable, Category = "Enemy Spawn")
+	bool CancelSpawn(int32 RequestId);
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Spawn")
+	int32 GetNumPendingSpawns() const { return Requests.Num(); }
+
+	UPROPERTY(BlueprintAssignable, Category = "Enemy Spawn")
+	FOnEnemySpawnCompleted OnEnemySpawnCompleted;
+
+	FOnEnemySpawnCompletedNative OnEnemySpawnCompletedNative;
+
+	FString GetStatsString() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 프레임당 새로 생성할 최대 수 (풀이 비었을 때)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Spawn")
+	int32 MaxConstructionsPerFrame = 2;
+
+	// 프레임당 풀에서 재사용할 최대 수
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Spawn")
+	int32 MaxReusesPerFrame = 16;
+
+private:
+	struct FSpawnRequest
+	{
+		int32 Id = INDEX_NONE;
+		TSoftClassPtr<ABaseEnemy> EnemyClass;
+		FTransform SpawnTransform;
+		double RequestTime = 0.0;
+	};
+
+	struct FClassLoadState
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		double RequestTime = 0.0;
+		// 로드가 끝난 시각 (0이면 로드 중)
+		double LoadedTime = 0.0;
+		bool bFailed = false;
+	};
+
+	FClassLoadState& RequestClassLoad(const TSoftClassPtr<ABaseEnemy>& EnemyClass);
+	void HandleClassLoaded(FSoftObjectPath ClassPath);
+
+	TArray<FSpawnRequest> Requests;
+	TMap<FSoftObjectPath, FClassLoadState> ClassLoads;
+
+	// 처리 중 완료 콜백이 새 요청을 넣어도 안전하도록 결과를 먼저 모은다
+	TArray<FEnemySpawnResult> PendingResults;
+
+	int32 NextRequestId = 0;
+
+	// === 통계 ===
+	int32 NumCompleted = 0;
+	int32 NumConstructed = 0;
+	int32 NumReused = 0;
+	int32 NumFailed = 0;
+	float AverageLatency = 0.0f;
+	float MaxLatency = 0.0f;
+};
@@ -0,0 +1,464 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemySquadSubsystem.h"
+#include "BaseEnemy.h"
+#include "LogicStats.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace EnemySquad
+{
+	// 현재 타겟을 유지하는 가중치 (새 후보가 이만큼 더 가까워야 바꿈)
+	constexpr float TargetStickiness = 0.8f;
+}
+
+static FAutoConsoleCommandWithWorld GEnemySquadStatsCommand(
+	TEXT("Logic.EnemySquad.Stats"),
+	TEXT("분대 수, 교전 중인 분대와 공격 허가/거절 수를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UEnemySquadSubsystem* Squads = UEnemySquadSubsystem::Get(World))
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *Squads->GetStatsString());
+		}
+	}));
+
+UEnemySquadSubsystem* UEnemySquadSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemySquadSubsystem>() : nullptr;
+}
+
+bool UEnemySquadSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UEnemySquadSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemySquadSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemySquadSubsystem::Deinitialize()
+{
+	Members.Empty();
+	MemberStates.Empty();
+	MemberIndices.Empty();
+	Squads.Empty();
+
+	Super::Deinitialize();
+}
+
+void UEnemySquadSubsystem::RegisterEnemy(ABaseEnemy* Enemy)
+{
+	if (!Enemy || MemberIndices.Contains(Enemy))
+	{
+		return;
+	}
+
+	MemberIndices.Add(Enemy, Members.Add(Enemy));
+
+	FMemberState& State = MemberStates.AddDefaulted_GetRef();
+	const FVector Location = Enemy->GetActorLocation();
+	State.SquadIndex = FindSquadFor(Location);
+	if (State.SquadIndex == INDEX_NONE)
+	{
+		State.SquadIndex = AddSquad(Location);
+	}
+	++Squads[State.SquadIndex].NumMembers;
+}
+
+void UEnemySquadSubsystem::UnregisterEnemy(ABaseEnemy* Enemy)
+{
+	int32 Index = INDEX_NONE;
+	if (!MemberIndices.RemoveAndCopyValue(Enemy, Index))
+	{
+		return;
+	}
+
+	// 빈 분대는 다음 Tick에서 정리
+	if (Squads.IsValidIndex(MemberStates[Index].SquadIndex))
+	{
+		--Squads[MemberStates[Index].SquadIndex].NumMembers;
+	}
+
+	const int32 LastIndex = Members.Num() - 1;
+	if (Index != LastIndex)
+	{
+		MemberIndices.Add(Members[LastIndex], Index);
+	}
+	Members.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MemberStates.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+int32 UEnemySquadSubsystem::FindSquadFor(const FVector& Location) const
+{
+	int32 BestIndex = INDEX_NONE;
+	float BestDistanceSquared = FMath::Square(JoinRadius);
+	for (int32 Index = 0; Index < Squads.Num(); ++Index)
+	{
+		const FSquad& Squad = Squads[Index];
+		const float DistanceSquared = (float)FVector::DistSquared(Squad.Centroid, Location);
+		if (Squad.NumMembers < MaxSquadSize && DistanceSquared <= BestDistanceSquared)
+		{
+			BestIndex = Index;
+			BestDistanceSquared = DistanceSquared;
+		}
+	}
+	return BestIndex;
+}
+
+int32 UEnemySquadSubsystem::AddSquad(const FVector& Location)
+{
+	FSquad& Squad = Squads.AddDefaulted_GetRef();
+	Squad.Centroid = Location;
+	// 분대마다 판단 시점을 흩어 놓음 (난수 없이 결정적으로)
+	Squad.TimeSinceDecision = DecisionInterval * (float)(Squads.Num() % 4) / 4.0f;
+	return Squads.Num() - 1;
+}
+
+void UEnemySquadSubsystem::Tick(float DeltaTime)
+{
+	NumDecisionsLastFrame = 0;
+	if (Members.Num() == 0)
+	{
+		Squads.Reset();
+		NumEngagedSquads = 0;
+		return;
+	}
+
+	LOGIC_COMBAT_SCOPE(STAT_LogicSquads);
+
+	// 1. 빈 분대 정리 후 분대별 멤버 목록과 중심 갱신
+	RemoveEmptySquads();
+	GatherSquads();
+
+	// 2. 판단 주기가 된 분대만 타겟/슬롯/공격 허가 결정
+	PendingTargets.Reset();
+	NumEngagedSquads = 0;
+	for (FSquad& Squad : Squads)
+	{
+		Squad.TimeSinceDecision += DeltaTime;
+		if (Squad.TimeSinceDecision >= DecisionInterval && Squad.MemberIndices.Num() > 0)
+		{
+			Squad.TimeSinceDecision = 0.0f;
+			DecideSquad(Squad);
+			++NumDecisionsLastFrame;
+		}
+		NumEngagedSquads += Squad.Target.IsValid() ? 1 : 0;
+	}
+
+	// 3. 교전하지 않는 멤버가 분대에서 멀어졌으면 가까운 분대로 옮김
+	for (int32 Index = 0; Index < Members.Num(); ++Index)
+	{
+		const ABaseEnemy* Enemy = Members[Index];
+		FMemberState& State = MemberStates[Index];
+		if (!IsValid(Enemy) || Enemy->GetTarget() || !Squads.IsValidIndex(State.SquadIndex)
+			|| FVector::DistSquared(Enemy->GetActorLocation(), Squads[State.SquadIndex].Centroid) <= FMath::Square(LeaveRadius))
+		{
+			continue;
+		}
+
+		--Squads[State.SquadIndex].NumMembers;
+		State = FMemberState();
+		State.SquadIndex = FindSquadFor(Enemy->GetActorLocation());
+		if (State.SquadIndex == INDEX_NONE)
+		{
+			State.SquadIndex = AddSquad(Enemy->GetActorLocation());
+		}
+		++Squads[State.SquadIndex].NumMembers;
+	}
+
+	// 4. 공동 타겟 전달 (블루프린트 이벤트가 등록 목록을 바꿀 수 있으므로 마지막에)
+	for (const TPair<TObjectPtr<ABaseEnemy>, TObjectPtr<APawn>>& Pending : PendingTargets)
+	{
+		if (IsValid(Pending.Key) && Pending.Key->IsAlive() && IsValid(Pending.Value))
+		{
+			Pending.Key->SetTarget(Pending.Value);
+		}
+	}
+	PendingTargets.Reset();
+
+	CSV_CUSTOM_STAT(LogicCombat, Squads, Squads.Num(), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(LogicCombat, SquadDecisions, NumDecisionsLastFrame, ECsvCustomStatOp::Set);
+}
+
+void UEnemySquadSubsystem::RemoveEmptySquads()
+{
+	// 남는 분대의 새 인덱스 (제거된 분대는 INDEX_NONE)
+	TArray<int32, TInlineAllocator<32>> Remap;
+	Remap.SetNumUninitialized(Squads.Num());
+
+	int32 NumKept = 0;
+	for (int32 Index = 0; Index < Squads.Num(); ++Index)
+	{
+		if (Squads[Index].NumMembers > 0)
+		{
+			if (NumKept != Index)
+			{
+				Squads[NumKept] = MoveTemp(Squads[Index]);
+			}
+			Remap[Index] = NumKept++;
+		}
+		else
+		{
+			Remap[Index] = INDEX_NONE;
+		}
+	}
+
+	if (NumKept == Squads.Num())
+	{
+		return;
+	}
+
+	Squads.SetNum(NumKept, EAllowShrinking::No);
+	for (FMemberState& State : MemberStates)
+	{
+		State.SquadIndex = Remap.IsValidIndex(State.SquadIndex) ? Remap[State.SquadIndex] : INDEX_NONE;
+	}
+}
+
+void UEnemySquadSubsystem::GatherSquads()
+{
+	for (FSquad& Squad : Squads)
+	{
+		Squad.MemberIndices.Reset();
+	}
+
+	TArray<FVector, TInlineAllocator<32>> LocationSums;
+	LocationSums.SetNumZeroed(Squads.Num());
+	for (int32 Index = 0; Index < Members.Num(); ++Index)
+	{
+		const ABaseEnemy* Enemy = Members[Index];
+		const int32 SquadIndex = MemberStates[Index].SquadIndex;
+		if (IsValid(Enemy) && Enemy->IsAlive() && Squads.IsValidIndex(SquadIndex))
+		{
+			Squads[SquadIndex].MemberIndices.Add(Index);
+			LocationSums[SquadIndex] += Enemy->GetActorLocation();
+		}
+	}
+
+	for (int32 Index = 0; Index < Squads.Num(); ++Index)
+	{
+		FSquad& Squad = Squads[Index];
+		if (Squad.MemberIndices.Num() > 0)
+		{
+			Squad.Centroid = LocationSums[Index] / (double)Squad.MemberIndices.Num();
+		}
+	}
+}
+
+void UEnemySquadSubsystem::DecideSquad(FSquad& Squad)
+{
+	APawn* Target = SelectTarget(Squad);
+	Squad.Target = Target;
+
+	if (!Target)
+	{
+		for (const int32 Index : Squad.MemberIndices)
+		{
+			FMemberState& State = MemberStates[Index];
+			State.bHasAttackSlot = false;
+			State.bHasAttackToken = false;
+		}
+		return;
+	}
+
+	AssignAttackSlots(Squad, Target);
+	AssignAttackTokens(Squad, Target);
+
+	// 멤버 하나가 발견한 타겟을 분대 전체가 공유 (나머지 멤버는 감지 없이 교전)
+	for (const int32 Index : Squad.MemberIndices)
+	{
+		ABaseEnemy* Enemy = Members[Index];
+		if (Enemy->GetTarget() != Target)
+		{
+			PendingTargets.Emplace(Enemy, Target);
+		}
+	}
+}
+
+APawn* UEnemySquadSubsystem::SelectTarget(const FSquad& Squad) const
+{
+	float MaxDetectionRange = 0.0f;
+	for (const int32 Index : Squad.MemberIndices)
+	{
+		MaxDetectionRange = FMath::Max(MaxDetectionRange, Members[Index]->DetectionRange);
+	}
+	const float MaxDistanceSquared = FMath::Square(MaxDetectionRange * DisengageRangeScale);
+
+	// 후보: 지금 분대 타겟 + 멤버들이 각자 감지한 타겟. 분대 중심에 가장 가까운 것 (현재 타겟 우대)
+	APawn* BestTarget = nullptr;
+	float BestScore = TNumericLimits<float>::Max();
+	auto ConsiderTarget = [&](APawn* Candidate, float Scale)
+	{
+		if (!IsValid(Candidate))
+		{
+			return;
+		}
+
+		const float DistanceSquared = (float)FVector::DistSquared(Candidate->GetActorLocation(), Squad.Centroid);
+		if (DistanceSquared <= MaxDistanceSquared && DistanceSquared * Scale < BestScore)
+		{
+			BestTarget = Candidate;
+			BestScore = DistanceSquared * Scale;
+		}
+	};
+
+	ConsiderTarget(Squad.Target.Get(), FMath::Square(EnemySquad::TargetStickiness));
+	for (const int32 Index : Squad.MemberIndices)
+	{
+		ConsiderTarget(Members[Index]->GetTarget(), 1.0f);
+	}
+	return BestTarget;
+}
+
+void UEnemySquadSubsystem::AssignAttackSlots(FSquad& Squad, const APawn* Target)
+{
+	const FVector TargetLocation = Target->GetActorLocation();
+
+	// 가까운 멤버부터 슬롯을 고름
+	TArray<int32, TInlineAllocator<8>> Order(Squad.MemberIndices);
+	Order.Sort([this, &TargetLocation](int32 A, int32 B)
+	{
+		return FVector::DistSquared(Members[A]->GetActorLocation(), TargetLocation) < FVector::DistSquared(Members[B]->GetActorLocation(), TargetLocation);
+	});
+
+	// 분대가 있는 쪽부터 타겟을 고르게 둘러싸는 방향
+	FVector BaseDirection = (Squad.Centroid - TargetLocation).GetSafeNormal2D();
+	if (BaseDirection.IsNearlyZero())
+	{
+		BaseDirection = FVector::ForwardVector;
+	}
+
+	const int32 NumSlots = FMath::Min(FMath::Max(MaxAttackSlots, 0), Order.Num());
+	TArray<FVector, TInlineAllocator<8>> SlotDirections;
+	TArray<bool, TInlineAllocator<8>> SlotTaken;
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		SlotDirections.Add(BaseDirection.RotateAngleAxis(360.0f * Slot / NumSlots, FVector::UpVector));
+		SlotTaken.Add(false);
+	}
+
+	for (const int32 Index : Order)
+	{
+		const ABaseEnemy* Enemy = Members[Index];
+		FMemberState& State = MemberStates[Index];
+
+		FVector ToMember = (Enemy->GetActorLocation() - TargetLocation).GetSafeNormal2D();
+		if (ToMember.IsNearlyZero())
+		{
+			ToMember = BaseDirection;
+		}
+
+		// 자기 방향과 가장 가까운 빈 슬롯 (돌아가는 거리 최소화)
+		int32 BestSlot = INDEX_NONE;
+		float BestDot = -2.0f;
+		for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+		{
+			const float Dot = (float)FVector::DotProduct(ToMember, SlotDirections[Slot]);
+			if (!SlotTaken[Slot] && Dot > BestDot)
+			{
+				BestSlot = Slot;
+				BestDot = Dot;
+			}
+		}
+
+		State.bHasAttackSlot = BestSlot != INDEX_NONE;
+		if (State.bHasAttackSlot)
+		{
+			SlotTaken[BestSlot] = true;
+			State.MoveLocation = TargetLocation + SlotDirections[BestSlot] * Enemy->AttackRange * SlotRangeFraction;
+		}
+		else
+		{
+			// 슬롯이 빌 때까지 공격 범위 밖에서 대기
+			State.MoveLocation = TargetLocation + ToMember * Enemy->AttackRange * WaitRingRangeScale;
+		}
+	}
+}
+
+void UEnemySquadSubsystem::AssignAttackTokens(FSquad& Squad, const APawn* Target)
+{
+	const FVector TargetLocation = Target->GetActorLocation();
+
+	// 슬롯에 있고 공격 가능한(CanAttack, 쿨다운 끝남) 멤버 중 가장 오래 공격하지 않은 순서로 허가
+	TArray<int32, TInlineAllocator<8>> Ready;
+	for (const int32 Index : Squad.MemberIndices)
+	{
+		const ABaseEnemy* Enemy = Members[Index];
+		FMemberState& State = MemberStates[Index];
+		State.bHasAttackToken = false;
+
+		if (State.bHasAttackSlot && Enemy->CanAttack()
+			&& FVector::DistSquared(Enemy->GetActorLocation(), TargetLocation) <= FMath::Square(Enemy->AttackRange))
+		{
+			Ready.Add(Index);
+		}
+	}
+
+	Ready.StableSort([this](int32 A, int32 B) { return MemberStates[A].LastAttackTime < MemberStates[B].LastAttackTime; });
+
+	const int32 NumTokens = FMath::Min(FMath::Max(MaxSimultaneousAttackers, 1), Ready.Num());
+	for (int32 Token = 0; Token < NumTokens; ++Token)
+	{
+		MemberStates[Ready[Token]].bHasAttackToken = true;
+	}
+}
+
+bool UEnemySquadSubsystem::GetOrder(const ABaseEnemy* Enemy, FEnemySquadOrder& OutOrder) const
+{
+	const int32* Index = MemberIndices.Find(Enemy);
+	if (!Index)
+	{
+		return false;
+	}
+
+	const FMemberState& State = MemberStates[*Index];
+	if (!Squads.IsValidIndex(State.SquadIndex) || !Squads[State.SquadIndex].Target.IsValid())
+	{
+		return false;
+	}
+
+	OutOrder.Target = Squads[State.SquadIndex].Target;
+	OutOrder.MoveLocation = State.MoveLocation;
+	OutOrder.bHasAttackSlot = State.bHasAttackSlot;
+	return true;
+}
+
+bool UEnemySquadSubsystem::RequestAttack(const ABaseEnemy* Enemy)
+{
+	const int32* Index = MemberIndices.Find(Enemy);
+	if (!Index)
+	{
+		// 분대에 속하지 않은 적은 제한 없음
+		return true;
+	}
+
+	FMemberState& State = MemberStates[*Index];
+	if (!Squads.IsValidIndex(State.SquadIndex))
+	{
+		return true;
+	}
+
+	FSquad& Squad = Squads[State.SquadIndex];
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (!State.bHasAttackToken || Now < Squad.NextAttackTime)
+	{
+		++NumAttacksDenied;
+		return false;
+	}
+
+	// 허가는 한 번만 쓰고 다음 판단에서 다른 멤버에게 넘어감
+	State.bHasAttackToken = false;
+	State.LastAttackTime = Now;
+	Squad.NextAttackTime = Now + AttackStaggerInterval;
+	++NumAttacksGranted;
+	return true;
+}
+
+FString UEnemySquadSubsystem::GetStatsString() const
+{
+	return FString::Printf(TEXT("Enemy Squads - Squads: %d (engaged %d), Members: %d, Decisions last frame: %d (every %.2fs), Attacks granted: %d, denied: %d"),
+		Squads.Num(), NumEngagedSquads, Members.Num(), NumDecisionsLastFrame, DecisionInterval, NumAttacksGranted, NumAttacksDenied);
+}
@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemySquadSubsystem.generated.h"
+
+class ABaseEnemy;
+
+// 분대가 멤버 하나에게 내린 지시 (상태 머신이 이동/공격 때 사용)
+struct FEnemySquadOrder
+{
+	// 분대 공동 타겟
+	TWeakObjectPtr<APawn> Target;
+
+	// 이동할 위치 (공격 슬롯 또는 대기 링)
+	FVector MoveLocation = FVector::ZeroVector;
+
+	// 타겟 주변 공격 슬롯을 받았는지 (false면 슬롯이 빌 때까지 대기 링에서 기다림)
+	bool bHasAttackSlot = false;
+};
+
+/**
+ * 가까운 네이티브 상태 머신 적을 분대로 묶어 분대 단위로 판단하는 서브시스템
+ * 분대마다 판단 컨텍스트 하나를 두고 DecisionInterval마다 공동 타겟 선택(멤버 하나가 발견하면 분대 전체가 교전),
+ * 타겟 주변 공격 슬롯 배정(포위), 동시에 공격할 멤버 선정을 한 번에 처리한다.
+ * 멤버는 UEnemyStateMachineSubsystem에서 지시받은 위치로 이동하고 공격 허가(RequestAttack)를 받았을 때만 공격한다.
+ * 공격 허가는 멤버의 CanAttack/AttackCooldown을 그대로 따르며 분대 안에서 MaxSimultaneousAttackers명,
+ * AttackStaggerInterval 간격으로 돌아가며 주어진다. 판단 비용은 적 수가 아니라 분대 수에 비례한다.
+ */
+UCLASS(config=Game)
+class LOGIC_API UEnemySquadSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemySquadSubsystem* Get(const UObject* WorldContextObject);
+
+	// 가까운 분대에 넣음 (자리가 없으면 새 분대)
+	void RegisterEnemy(ABaseEnemy* Enemy);
+	void UnregisterEnemy(ABaseEnemy* Enemy);
+
+	// 분대의 현재 지시. 분대가 교전 중이 아니면 false
+	bool GetOrder(const ABaseEnemy* Enemy, FEnemySquadOrder& OutOrder) const;
+
+	// 공격 직전에 호출: 허가를 받은 멤버이고 분대의 공격 간격이 지났으면 true (허가는 소모됨)
+	bool RequestAttack(const ABaseEnemy* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Squad")
+	int32 GetNumSquads() const { return Squads.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Enemy Squad")
+	int32 GetNumMembers() const { return Members.Num(); }
+
+	FString GetStatsString() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 분대 판단 주기 (초). 분대마다 시작 시점을 흩어 같은 프레임에 몰리지 않게 함
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Squad")
+	float DecisionInterval = 0.25f;
+
+	// 분대 최대 인원
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Squad")
+	int32 MaxSquadSize = 8;
+
+	// 분대 중심에서 이 거리 안이면 합류
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Squad")
+	float JoinRadius = 1500.0f;
+
+	// 교전 중이 아닌 멤버가 분대 중심에서 이 거리보다 멀어지면 다른 분대로 옮김
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Squad")
+	float LeaveRadius = 2500.0f;
+
+	// 타겟 주변 공격 슬롯 수 (나머지 멤버는 대기 링)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Squad|Combat")
+	int32 MaxAttackSlots = 4;
+
+	// 슬롯 반경 = 멤버 AttackRange x 이 값 (1보다 작아야 슬롯에서 공격 범위 안)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Squad|Combat")
+	float SlotRangeFraction = 0.7f;
+
+	// 대기 링 반경 = 멤버 AttackRange x 이 값
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Squad|Combat")
+	float WaitRingRangeScale = 2.5f;
+
+	// 분대에서 동시에 공격 허가를 받을 수 있는 수
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Squad|Combat")
+	int32 MaxSimultaneousAttackers = 2;
+
+	// 분대 안 공격 사이 최소 간격 (초)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Squad|Combat")
+	float AttackStaggerInterval = 0.35f;
+
+	// 분대 중심에서 타겟이 (멤버 최대 DetectionRange x 이 값)보다 멀어지면 분대 교전 해제
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy Squad|Combat")
+	float DisengageRangeScale = 1.5f;
+
+private:
+	struct FMemberState
+	{
+		int32 SquadIndex = INDEX_NONE;
+		FVector MoveLocation = FVector::ZeroVector;
+		bool bHasAttackSlot = false;
+		bool bHasAttackToken = false;
+		double LastAttackTime = 0.0;
+	};
+
+	struct FSquad
+	{
+		TWeakObjectPtr<APawn> Target;
+		FVector Centroid = FVector::ZeroVector;
+		float TimeSinceDecision = 0.0f;
+		double NextAttackTime = 0.0;
+
+		// 등록된 멤버 수 (0이 되면 다음 Tick에서 제거)
+		int32 NumMembers = 0;
+
+		// 이번 프레임 멤버 목록 (Members 인덱스)
+		TArray<int32, TInlineAllocator<8>> MemberIndices;
+	};
+
+	int32 FindSquadFor(const FVector& Location) const;
+	int32 AddSquad(const FVector& Location);
+	void GatherSquads();
+	void RemoveEmptySquads();
+	void DecideSquad(FSquad& Squad);
+	APawn* SelectTarget(const FSquad& Squad) const;
+	void AssignAttackSlots(FSquad& Squad, const APawn* Target);
+	void AssignAttackTokens(FSquad& Squad, const APawn* Target);
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABaseEnemy>> Members;
+
+	TArray<FMemberState> MemberStates;
+	TMap<const ABaseEnemy*, int32> MemberIndices;
+
+	TArray<FSquad> Squads;
+
+	// 판단 결과로 타겟을 바꿔 줄 멤버 (판단이 모두 끝난 뒤 적용)
+	TArray<TPair<TObjectPtr<ABaseEnemy>, TObjectPtr<APawn>>> PendingTargets;
+
+	// === 통계 ===
+	int32 NumDecisionsLastFrame = 0;
+	int32 NumEngagedSquads = 0;
+	int32 NumAttacksGranted = 0;
+	int32 NumAttacksDenied = 0;
+};
@@ -0,0 +1,501 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EnemyStateMachineSubsystem.h"
+#include "EnemyFlowFieldSubsystem.h"
+#include "EnemyRegistrySubsystem.h"
+#include "EnemySquadSubsystem.h"
+#include "LogicReplaySubsystem.h"
+#include "LogicStats.h"
+#include "AIController.h"
+#include "Algo/StableSort.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "NavigationSystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace EnemyStateMachine
+{
+	constexpr int32 NumStates = (int32)EEnemyState::Dead + 1;
+
+	// 분대 지시 위치가 이 거리 이상 바뀌었거나 이만큼 벗어나 있으면 이동 요청
+	constexpr float SquadMoveTolerance = 50.0f;
+}
+
+static FAutoConsoleCommandWithWorld GEnemyStateMachineStatsCommand(
+	TEXT("Logic.EnemyFSM.Stats"),
+	TEXT("상태 머신 적 수와 프레임 예산 스케줄러의 처리/미룸/기아 지표를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UEnemyStateMachineSubsystem* StateMachine = UEnemyStateMachineSubsystem::Get(World))
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *StateMachine->GetStatsString());
+		}
+	}));
+
+UEnemyStateMachineSubsystem::UEnemyStateMachineSubsystem()
+{
+	// 기본 전환 테이블 (기존 Behavior Tree의 대기/순찰/추적/공격 흐름)
+	Transitions = {
+		{ EEnemyState::Idle,       EEnemyFSMCondition::HasTarget,                 0.0f, EEnemyState::Chasing },
+		{ EEnemyState::Idle,       EEnemyFSMCondition::StateTimeElapsed,          3.0f, EEnemyState::Patrolling },
+		{ EEnemyState::Patrolling, EEnemyFSMCondition::HasTarget,                 0.0f, EEnemyState::Chasing },
+		{ EEnemyState::Patrolling, EEnemyFSMCondition::MoveFinished,              0.0f, EEnemyState::Idle },
+		{ EEnemyState::Chasing,    EEnemyFSMCondition::LostTarget,                0.0f, EEnemyState::Idle },
+		{ EEnemyState::Chasing,    EEnemyFSMCondition::TargetOutOfDetectionRange, 0.0f, EEnemyState::Idle },
+		{ EEnemyState::Chasing,    EEnemyFSMCondition::TargetInAttackRange,       0.0f, EEnemyState::Attacking },
+		{ EEnemyState::Attacking,  EEnemyFSMCondition::LostTarget,                0.0f, EEnemyState::Idle },
+		{ EEnemyState::Attacking,  EEnemyFSMCondition::TargetOutOfAttackRange,    0.0f, EEnemyState::Chasing },
+	};
+}
+
+UEnemyStateMachineSubsystem* UEnemyStateMachineSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemyStateMachineSubsystem>() : nullptr;
+}
+
+bool UEnemyStateMachineSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyStateMachineSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	BuildTransitionLookup();
+}
+
+void UEnemyStateMachineSubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	Runtimes.Empty();
+	EnemyIndices.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyStateMachineSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyStateMachineSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyStateMachineSubsystem::BuildTransitionLookup()
+{
+	// From 상태별로 묶되 같은 상태 안에서는 테이블 순서(우선순위) 유지
+	TransitionOrder.Reset(Transitions.Num());
+	for (int32 Index = 0; Index < Transitions.Num(); ++Index)
+	{
+		TransitionOrder.Add(Index);
+	}
+	Algo::StableSortBy(TransitionOrder, [this](int32 Index) { return (int32)Transitions[Index].From; });
+
+	TransitionRanges.Init(TPair<int32, int32>(0, 0), EnemyStateMachine::NumStates);
+	for (int32 Order = 0; Order < TransitionOrder.Num(); ++Order)
+	{
+		const int32 From = (int32)Transitions[TransitionOrder[Order]].From;
+		if (TransitionRanges[From].Key == TransitionRanges[From].Value)
+		{
+			TransitionRanges[From].Key = Order;
+		}
+		TransitionRanges[From].Value = Order + 1;
+	}
+}
+
+void UEnemyStateMachineSubsystem::RegisterEnemy(ABaseEnemy* Enemy)
+{
+	if (!Enemy || EnemyIndices.Contains(Enemy))
+	{
+		return;
+	}
+
+	EnemyIndices.Add(Enemy, Enemies.Add(Enemy));
+
+	FRuntime& Runtime = Runtimes.AddDefaulted_GetRef();
+	Runtime.HomeLocation = Enemy->GetActorLocation();
+	// 다음 프레임에 바로 평가 대상
+	Runtime.TimeSinceUpdate = EvaluationInterval;
+
+	// 상태 머신이 대신 처리하므로 액터 Tick은 끈다
+	Enemy->SetActorTickEnabled(false);
+}
+
+void UEnemyStateMachineSubsystem::UnregisterEnemy(ABaseEnemy* Enemy, bool bRestoreActorTick)
+{
+	int32 Index = INDEX_NONE;
+	if (!EnemyIndices.RemoveAndCopyValue(Enemy, Index))
+	{
+		return;
+	}
+
+	const int32 LastIndex = Enemies.Num() - 1;
+	if (Index != LastIndex)
+	{
+		EnemyIndices.Add(Enemies[LastIndex], Index);
+	}
+	Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Runtimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (bRestoreActorTick)
+	{
+		Enemy->SetActorTickEnabled(true);
+	}
+}
+
+void UEnemyStateMachineSubsystem::NotifyStateChanged(const ABaseEnemy* Enemy)
+{
+	if (const int32* Index = EnemyIndices.Find(Enemy))
+	{
+		Runtimes[*Index].TimeInState = 0.0f;
+	}
+}
+
+void UEnemyStateMachineSubsystem::Tick(float DeltaTime)
+{
+	if (Enemies.Num() == 0)
+	{
+		NumUpdatedLastFrame = 0;
+		NumDeferredLastFrame = 0;
+		NumStarved = 0;
+		return;
+	}
+
+	LOGIC_COMBAT_SCOPE(STAT_LogicEnemyTick);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	TArray<FVector, TInlineAllocator<4>> PlayerLocations;
+	if (const UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		for (const APawn* Player : Registry->GetRegisteredPlayers())
+		{
+			if (IsValid(Player))
+			{
+				PlayerLocations.Add(Player->GetActorLocation());
+			}
+		}
+	}
+
+	// 1. 평가 주기가 된 적을 우선순위와 함께 모음 (적 상태는 바꾸지 않음)
+	ScheduledUpdates.Reset();
+	for (int32 Index = 0; Index < Enemies.Num(); ++Index)
+	{
+		const ABaseEnemy* Enemy = Enemies[Index];
+		FRuntime& Runtime = Runtimes[Index];
+		if (!IsValid(Enemy) || !Enemy->IsAlive() || Enemy->IsAIPaused())
+		{
+			// 멈춘 적은 기다리는 것으로 치지 않음
+			Runtime.TimeSinceUpdate = 0.0f;
+			continue;
+		}
+
+		Runtime.TimeSinceUpdate += DeltaTime;
+		if (Runtime.TimeSinceUpdate >= EvaluationInterval)
+		{
+			ScheduledUpdates.Add({ Enemies[Index], ComputePriority(Enemy, Runtime, PlayerLocations) });
+		}
+	}
+
+	ScheduledUpdates.Sort([](const FScheduledUpdate& A, const FScheduledUpdate& B) { return A.Priority > B.Priority; });
+
+	// 2. 예산이 다할 때까지 우선순위 순으로 평가 (이벤트 콜백이 등록 목록을 바꿀 수 있으므로 인덱스를 다시 찾음)
+	const UEnemyFlowFieldSubsystem* FlowField = UEnemyFlowFieldSubsystem::Get(this);
+	UEnemySquadSubsystem* Squads = UEnemySquadSubsystem::Get(this);
+	const uint64 BudgetCycles = (uint64)(FMath::Max(MaxUpdateMilliseconds, 0.0f) / 1000.0 / FPlatformTime::GetSecondsPerCycle64());
+
+	// 리플레이는 같은 시드/입력/타임스텝이면 같은 결과가 나와야 하므로 벽시계 예산을 쓰지 않음
+	const ULogicReplaySubsystem* Replay = ULogicReplaySubsystem::Get(this);
+	const bool bFixedBudget = Replay && (Replay->IsRecording() || Replay->IsReplaying());
+	const int32 MaxFixedUpdates = FMath::Max(DeterministicUpdatesPerFrame, MinUpdatesPerFrame);
+
+	int32 NumProcessed = 0;
+	int32 NumUpdated = 0;
+	MaxLatencyLastFrame = 0.0f;
+	for (; NumProcessed < ScheduledUpdates.Num(); ++NumProcessed)
+	{
+		if (bFixedBudget ? NumUpdated >= MaxFixedUpdates
+			: (NumUpdated >= MinUpdatesPerFrame && FPlatformTime::Cycles64() - StartCycles >= BudgetCycles))
+		{
+			break;
+		}
+
+		ABaseEnemy* Enemy = ScheduledUpdates[NumProcessed].Enemy;
+		const int32* Index = EnemyIndices.Find(Enemy);
+		if (Index && IsValid(Enemy) && Enemy->IsAlive() && !Enemy->IsAIPaused())
+		{
+			UpdateEnemy(Enemy, *Index, FlowField, Squads);
+			++NumUpdated;
+		}
+	}
+
+	// 3. 기아 지표 (미뤄진 적 중 오래 기다린 적)
+	NumUpdatedLastFrame = NumUpdated;
+	NumDeferredLastFrame = ScheduledUpdates.Num() - NumProcessed;
+	NumStarved = 0;
+	for (const FRuntime& Runtime : Runtimes)
+	{
+		NumStarved += Runtime.TimeSinceUpdate >= StarvationThreshold ? 1 : 0;
+	}
+	ScheduledUpdates.Reset();
+
+	LastFrameMilliseconds = (float)FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	INC_DWORD_STAT_BY(STAT_LogicNumAIUpdates, NumUpdatedLastFrame);
+	INC_DWORD_STAT_BY(STAT_LogicNumAIDeferred, NumDeferredLastFrame);
+	SET_DWORD_STAT(STAT_LogicNumAIStarved, NumStarved);
+	CSV_CUSTOM_STAT(LogicCombat, AIUpdates, NumUpdatedLastFrame, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(LogicCombat, AIDeferred, NumDeferredLastFrame, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(LogicCombat, AIStarved, NumStarved, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(LogicCombat, AIMaxLatencyMs, MaxLatencyLastFrame * 1000.0f, ECsvCustomStatOp::Set);
+}
+
+float UEnemyStateMachineSubsystem::ComputePriority(const ABaseEnemy* Enemy, const FRuntime& Runtime, TConstArrayView<FVector> PlayerLocations) const
+{
+	// 기다린 주기 수에 비례하므로 오래 밀린 적은 결국 앞으로 옴
+	float Priority = Runtime.TimeSinceUpdate / FMath::Max(EvaluationInterval, KINDA_SMALL_NUMBER);
+
+	if (PlayerLocations.Num() > 0 && PriorityFalloffDistance > 0.0f)
+	{
+		const FVector EnemyLocation = Enemy->GetActorLocation();
+		float MinDistanceSquared = TNumericLimits<float>::Max();
+		for (const FVector& PlayerLocation : PlayerLocations)
+		{
+			MinDistanceSquared = FMath::Min(MinDistanceSquared, (float)FVector::DistSquared(EnemyLocation, PlayerLocation));
+		}
+
+		const float Alpha = FMath::Clamp(FMath::Sqrt(MinDistanceSquared) / PriorityFalloffDistance, 0.0f, 1.0f);
+		Priority *= FMath::Lerp(NearPriorityScale, 1.0f, Alpha);
+	}
+
+	return Priority;
+}
+
+void UEnemyStateMachineSubsystem::UpdateEnemy(ABaseEnemy* Enemy, int32 Index, const UEnemyFlowFieldSubsystem* FlowField, UEnemySquadSubsystem* Squads)
+{
+	FRuntime& Runtime = Runtimes[Index];
+	const float ElapsedTime = Runtime.TimeSinceUpdate;
+	Runtime.TimeSinceUpdate = 0.0f;
+	Runtime.TimeInState += ElapsedTime;
+	Runtime.TimeSinceAttack += ElapsedTime;
+
+	MaxLatencyLastFrame = FMath::Max(MaxLatencyLastFrame, ElapsedTime);
+	PeakLatency = FMath::Max(PeakLatency, ElapsedTime);
+	AverageLatency = AverageLatency > 0.0f ? FMath::Lerp(AverageLatency, ElapsedTime, 0.05f) : ElapsedTime;
+
+	// 전환 판정
+	const EEnemyState State = Enemy->GetCurrentState();
+	const float DistanceToTarget = Enemy->GetDistanceToTarget();
+	const TPair<int32, int32>& Range = TransitionRanges[(int32)State];
+	for (int32 Order = Range.Key; Order < Range.Value; ++Order)
+	{
+		const FEnemyStateTransition& Transition = Transitions[TransitionOrder[Order]];
+		if (EvaluateCondition(Transition, Enemy, Runtime, DistanceToTarget))
+		{
+			EnterState(Enemy, Runtime, Transition.To);
+			break;
+		}
+	}
+
+	// 상태별 지속 동작 (추적 이동 유지, 공격). 전환 중 등록 목록이 바뀌었을 수 있으므로 다시 찾음
+	const int32* CurrentIndex = EnemyIndices.Find(Enemy);
+	if (CurrentIndex && Enemy->IsAlive() && !Enemy->IsAIPaused())
+	{
+		UpdateState(Enemy, Runtimes[*CurrentIndex], FlowField, Squads);
+	}
+}
+
+bool UEnemyStateMachineSubsystem::EvaluateCondition(const FEnemyStateTransition& Transition, ABaseEnemy* Enemy, const FRuntime& Runtime, float DistanceToTarget) const
+{
+	const bool bHasTarget = Enemy->GetTarget() != nullptr;
+
+	switch (Transition.Condition)
+	{
+	case EEnemyFSMCondition::HasTarget:
+		return bHasTarget;
+	case EEnemyFSMCondition::LostTarget:
+		return !bHasTarget;
+	case EEnemyFSMCondition::TargetInAttackRange:
+		return bHasTarget && DistanceToTarget <= Enemy->AttackRange;
+	case EEnemyFSMCondition::TargetOutOfAttackRange:
+		return bHasTarget && DistanceToTarget > Enemy->AttackRange;
+	case EEnemyFSMCondition::TargetOutOfDetectionRange:
+		return bHasTarget && DistanceToTarget > Enemy->DetectionRange;
+	case EEnemyFSMCondition::StateTimeElapsed:
+		return Runtime.TimeInState >= Transition.Parameter;
+	case EEnemyFSMCondition::MoveFinished:
+	{
+		const AAIController* Controller = Cast<AAIController>(Enemy->GetController());
+		return !Runtime.bMoveRequested || !Controller || Controller->GetMoveStatus() == EPathFollowingStatus::Idle;
+	}
+	default:
+		return false;
+	}
+}
+
+void UEnemyStateMachineSubsystem::EnterState(ABaseEnemy* Enemy, FRuntime& Runtime, EEnemyState NewState)
+{
+	AAIController* Controller = Cast<AAIController>(Enemy->GetController());
+
+	Runtime.TimeInState = 0.0f;
+	Runtime.MoveGoalActor.Reset();
+	Runtime.MoveGoalLocation = FVector::ZeroVector;
+	Runtime.bMoveRequested = false;
+
+	switch (NewState)
+	{
+	case EEnemyState::Idle:
+		if (Controller)
+		{
+			Controller->StopMovement();
+		}
+		// 타겟이 멀어져서 대기로 돌아가는 경우 타겟도 해제
+		if (Enemy->GetTarget())
+		{
+			Enemy->StopChasing();
+		}
+		else
+		{
+			Enemy->SetEnemyState(EEnemyState::Idle);
+		}
+		break;
+
+	case EEnemyState::Patrolling:
+	{
+		Enemy->SetEnemyState(EEnemyState::Patrolling);
+
+		FNavLocation PatrolLocation;
+		const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+		if (Controller && NavSys && NavSys->GetRandomReachablePointInRadius(Runtime.HomeLocation, PatrolRadius, PatrolLocation))
+		{
+			Controller->MoveToLocation(PatrolLocation.Location);
+			Runtime.bMoveRequested = true;
+		}
+		break;
+	}
+
+	case EEnemyState::Chasing:
+		Enemy->StartChasing();
+		break;
+
+	case EEnemyState::Attacking:
+		if (Controller)
+		{
+			Controller->StopMovement();
+		}
+		Enemy->SetEnemyState(EEnemyState::Attacking);
+		break;
+
+	default:
+		Enemy->SetEnemyState(NewState);
+		break;
+	}
+}
+
+void UEnemyStateMachineSubsystem::UpdateState(ABaseEnemy* Enemy, FRuntime& Runtime, const UEnemyFlowFieldSubsystem* FlowField, UEnemySquadSubsystem* Squads)
+{
+	APawn* Target = Enemy->GetTarget();
+	if (!Target)
+	{
+		return;
+	}
+
+	switch (Enemy->GetCurrentState())
+	{
+	case EEnemyState::Chasing:
+	{
+		// 경로 요청 캐시: 같은 목표를 따라가는 중이면 다시 요청하지 않음
+		AAIController* Controller = Cast<AAIController>(Enemy->GetController());
+		if (!Controller)
+		{
+			break;
+		}
+
+		// 멀리 있으면 플레이어 흐름장을 따라 몇 칸 앞 지점으로 직선 이동 (개별 경로 요청 없음)
+		const float DistanceToTarget = Enemy->GetDistanceToTarget();
+		FVector Waypoint;
+		if (FlowField && DistanceToTarget > FlowField->GetDirectChaseDistance()
+			&& FlowField->GetWaypoint(Target, Enemy->GetActorLocation(), Waypoint))
+		{
+			if (Runtime.MoveGoalActor.IsValid() || !Waypoint.Equals(Runtime.MoveGoalLocation, 1.0f)
+				|| Controller->GetMoveStatus() == EPathFollowingStatus::Idle)
+			{
+				Controller->MoveToLocation(Waypoint, -1.0f, false, /*bUsePathfinding=*/false, /*bProjectDestinationToNavigation=*/false);
+				Runtime.MoveGoalActor.Reset();
+				Runtime.MoveGoalLocation = Waypoint;
+				Runtime.bMoveRequested = true;
+			}
+			break;
+		}
+
+		// 분대 교전 중이면 타겟 대신 배정받은 공격 슬롯(또는 대기 링)으로
+		FEnemySquadOrder Order;
+		if (Squads && Squads->GetOrder(Enemy, Order) && Order.Target == Target)
+		{
+			MoveToSquadLocation(Controller, Runtime, Order.MoveLocation);
+			break;
+		}
+
+		const bool bSameGoal = Runtime.MoveGoalActor.Get() == Target;
+		if (!bSameGoal || Controller->GetMoveStatus() == EPathFollowingStatus::Idle)
+		{
+			Controller->MoveToActor(Target, Enemy->AttackRange * 0.8f);
+			Runtime.MoveGoalActor = Target;
+			Runtime.bMoveRequested = true;
+		}
+		break;
+	}
+
+	case EEnemyState::Attacking:
+	{
+		// 분대 멤버는 분대가 정한 순서대로만 공격
+		FEnemySquadOrder Order;
+		const bool bInSquad = Squads && Squads->GetOrder(Enemy, Order) && Order.Target == Target;
+		// CanAttack 플래그와 별개로 상태 머신도 마지막 공격 후 AttackCooldown을 기다림
+		const bool bCooldownElapsed = Runtime.TimeSinceAttack >= Enemy->GetAttackCooldown();
+		if (Enemy->CanAttack() && bCooldownElapsed && (!bInSquad || Squads->RequestAttack(Enemy)))
+		{
+			// 타겟을 바라보고 공격
+			const FVector ToTarget = Target->GetActorLocation() - Enemy->GetActorLocation();
+			Enemy->SetActorRotation(FRotator(0.0f, ToTarget.Rotation().Yaw, 0.0f));
+			Enemy->Attack();
+			Runtime.TimeSinceAttack = 0.0f;
+		}
+		else if (bInSquad && FVector::DistSquared2D(Enemy->GetActorLocation(), Order.MoveLocation) > FMath::Square(EnemyStateMachine::SquadMoveTolerance))
+		{
+			// 차례를 기다리는 동안 자기 슬롯으로 돌아 들어가 타겟을 둘러쌈
+			if (AAIController* Controller = Cast<AAIController>(Enemy->GetController()))
+			{
+				MoveToSquadLocation(Controller, Runtime, Order.MoveLocation);
+			}
+		}
+		break;
+	}
+
+	default:
+		break;
+	}
+}
+
+void UEnemyStateMachineSubsystem::MoveToSquadLocation(AAIController* Controller, FRuntime& Runtime, const FVector& Location) const
+{
+	// 지시 위치가 거의 같고 이동 중이거나 이미 도착했으면 다시 요청하지 않음
+	const bool bSameGoal = !Runtime.MoveGoalActor.IsValid() && Runtime.bMoveRequested
+		&& Location.Equals(Runtime.MoveGoalLocation, EnemyStateMachine::SquadMoveTolerance);
+	if (bSameGoal && (Controller->GetMoveStatus() != EPathFollowingStatus::Idle
+		|| FVector::DistSquared2D(Controller->GetPawn()->GetActorLocation(), Location) <= FMath::Square(EnemyStateMachine::SquadMoveTolerance)))
+	{
+		return;
+	}
+
+	Controller->MoveToLocation(Location, EnemyStateMachine::SquadMoveTolerance * 0.5f);
+	Runtime.MoveGoalActor.Reset();
+	Runtime.MoveGoalLocation = Location;
+	Runtime.bMoveRequested = true;
+}
+
+FString UEnemyStateMachineSubsystem::GetStatsString() const
+{
+	return FString::Printf(TEXT("Enemy FSM - Enemies: %d, Updated: %d, Deferred: %d, Starved: %d (>= %.2fs), Frame: %.3f / %.3f ms, Latency avg %.3fs, last max %.3fs, peak %.3fs"),
+		Enemies.Num(), NumUpdatedLastFrame, NumDeferredLastFrame, NumStarved, StarvationThreshold,
+		LastFrameMilliseconds, MaxUpdateMilliseconds, AverageLatency, MaxLatencyLastFrame, PeakLatency);
+}
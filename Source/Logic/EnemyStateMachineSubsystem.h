@@ -0,0 +1,199 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BaseEnemy.h"
+#include "EnemyStateMachineSubsystem.generated.h"
+
+class UEnemyFlowFieldSubsystem;
+class UEnemySquadSubsystem;
+class AAIController;
+
+// 상태 전환 조건
+UENUM(BlueprintType)
+enum class EEnemyFSMCondition : uint8
+{
+	HasTarget                   UMETA(DisplayName = "Has Target"),
+	LostTarget                  UMETA(DisplayName = "Lost Target"),
+	TargetInAttackRange         UMETA(DisplayName = "Target In Attack Range"),
+	TargetOutOfAttackRange      UMETA(DisplayName = "Target Out Of Attack Range"),
+	TargetOutOfDetectionRange   UMETA(DisplayName = "Target Out Of Detection Range"),
+	StateTimeElapsed            UMETA(DisplayName = "State Time Elapsed"),
+	MoveFinished                UMETA(DisplayName = "Move Finished")
+};
+
+// 전환 테이블 한 줄: From 상태에서 Condition을 만족하면 To 상태로 (위에서부터 먼저 맞는 것 사용)
+USTRUCT(BlueprintType)
+struct FEnemyStateTransition
+{
+	GENERATED_BODY()
+
+	FEnemyStateTransition() = default;
+	FEnemyStateTransition(EEnemyState InFrom, EEnemyFSMCondition InCondition, float InParameter, EEnemyState InTo)
+		: From(InFrom), Condition(InCondition), Parameter(InParameter), To(InTo)
+	{
+	}
+
+	UPROPERTY(EditAnywhere, Category = "Enemy FSM")
+	EEnemyState From = EEnemyState::Idle;
+
+	UPROPERTY(EditAnywhere, Category = "Enemy FSM")
+	EEnemyFSMCondition Condition = EEnemyFSMCondition::HasTarget;
+
+	// StateTimeElapsed일 때 상태 유지 시간 (초)
+	UPROPERTY(EditAnywhere, Category = "Enemy FSM")
+	float Parameter = 0.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Enemy FSM")
+	EEnemyState To = EEnemyState::Chasing;
+};
+
+/**
+ * Normal 등급 적을 Behavior Tree 대신 네이티브 상태 머신으로 돌리는 서브시스템
+ * 전환 테이블(Transitions)은 config로 바꿀 수 있고, 등록된 적 전체를 한 번에 평가한다.
+ * 이동 요청은 목표가 바뀌었거나 경로 추종이 끝났을 때만 다시 보낸다 (MoveToActor가 움직이는 목표를 따라감).
+ * 타겟이 멀면 UEnemyFlowFieldSubsystem의 공유 흐름장 지점으로 직선 이동해 적마다 경로를 찾지 않는다.
+ * 분대(UEnemySquadSubsystem)에 속한 적은 가까이에서 타겟 대신 배정받은 공격 슬롯으로 이동하고 공격 허가를 받았을 때만 공격한다.
+ * 등록된 적은 자체 Tick이 꺼진다. Elite 이상은 기존처럼 Behavior Tree를 사용한다.
+ *
+ * 평가는 프레임당 시간 예산(MaxUpdateMilliseconds) 안에서 나눠 처리한다 (리플레이 녹화/재생 중에는 고정 개수). 평가 주기가 된 적을
+ * 기다린 시간 x 플레이어 거리 가중치 순으로 정렬해 예산이 다할 때까지 처리하고,
+ * 남은 적은 다음 프레임으로 미룬다. 기다린 시간이 우선순위에 곱해지므로 먼 적도 결국 처리된다.
+ * 예산은 이 상태 머신에 등록된 적(Normal 등급)에만 적용된다. Behavior Tree 적과 액터 Tick/일괄 업데이트
+ * 경로는 예산 밖에서 기존 주기대로 돈다.
+ */
+UCLASS(config=Game)
+class LOGIC_API UEnemyStateMachineSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UEnemyStateMachineSubsystem();
+
+	// === USubsystem ===
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemyStateMachineSubsystem* Get(const UObject* WorldContextObject);
+
+	// 등록하면 적의 액터 Tick이 꺼지고 해제하면 (bRestoreActorTick일 때) 다시 켜진다
+	void RegisterEnemy(ABaseEnemy* Enemy);
+	void UnregisterEnemy(ABaseEnemy* Enemy, bool bRestoreActorTick = true);
+
+	// 적의 상태가 바뀔 때 (상태 머신 밖에서 바뀐 경우 포함) 상태 유지 시간 초기화
+	void NotifyStateChanged(const ABaseEnemy* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "Enemy FSM")
+	int32 GetNumManagedEnemies() const { return Enemies.Num(); }
+
+	// 마지막 업데이트 후 StarvationThreshold 이상 처리되지 못한 적 수
+	UFUNCTION(BlueprintPure, Category = "Enemy FSM")
+	int32 GetNumStarvedEnemies() const { return NumStarved; }
+
+	// 평가 주기가 됐지만 예산 때문에 지난 프레임에 미뤄진 적 수
+	UFUNCTION(BlueprintPure, Category = "Enemy FSM")
+	int32 GetNumDeferredEnemies() const { return NumDeferredLastFrame; }
+
+	// 콘솔 출력용 요약 문자열
+	FString GetStatsString() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 적별 목표 평가 주기 (초). 예산이 모자라면 더 늦어질 수 있음
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy FSM")
+	float EvaluationInterval = 0.1f;
+
+	// 프레임당 평가에 쓸 최대 시간 (ms)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy FSM|Budget")
+	float MaxUpdateMilliseconds = 1.0f;
+
+	// 예산을 넘더라도 프레임당 최소 이만큼은 처리
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy FSM|Budget")
+	int32 MinUpdatesPerFrame = 4;
+
+	// 리플레이 녹화/재생 중에는 시간 예산 대신 프레임당 이만큼만 처리 (기계 속도와 상관없이 같은 적이 평가되도록)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy FSM|Budget")
+	int32 DeterministicUpdatesPerFrame = 64;
+
+	// 마지막 업데이트 후 이 시간(초)이 지나도 처리되지 못하면 기아 상태로 집계
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy FSM|Budget")
+	float StarvationThreshold = 0.5f;
+
+	// 플레이어 바로 옆 적의 거리 가중치. PriorityFalloffDistance에서 1로 줄어듦
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy FSM|Budget")
+	float NearPriorityScale = 3.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy FSM|Budget")
+	float PriorityFalloffDistance = 3000.0f;
+
+	// Patrolling 진입 시 시작 위치 기준 이동 반경
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy FSM")
+	float PatrolRadius = 600.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy FSM")
+	TArray<FEnemyStateTransition> Transitions;
+
+private:
+	// 적별 상태 머신 실행 데이터
+	struct FRuntime
+	{
+		float TimeInState = 0.0f;
+
+		// 마지막 평가 후 흐른 시간
+		float TimeSinceUpdate = 0.0f;
+
+		// 마지막 공격 후 흐른 시간 (AttackCooldown이 지나야 다시 공격)
+		float TimeSinceAttack = TNumericLimits<float>::Max();
+		FVector HomeLocation = FVector::ZeroVector;
+
+		// 마지막으로 요청한 이동 목표 (같은 목표면 다시 요청하지 않음)
+		TWeakObjectPtr<AActor> MoveGoalActor;
+		FVector MoveGoalLocation = FVector::ZeroVector;
+		bool bMoveRequested = false;
+	};
+
+	// 평가 주기가 된 적과 그 우선순위
+	struct FScheduledUpdate
+	{
+		TObjectPtr<ABaseEnemy> Enemy;
+		float Priority = 0.0f;
+	};
+
+	void BuildTransitionLookup();
+	float ComputePriority(const ABaseEnemy* Enemy, const FRuntime& Runtime, TConstArrayView<FVector> PlayerLocations) const;
+	void UpdateEnemy(ABaseEnemy* Enemy, int32 Index, const UEnemyFlowFieldSubsystem* FlowField, UEnemySquadSubsystem* Squads);
+	bool EvaluateCondition(const FEnemyStateTransition& Transition, ABaseEnemy* Enemy, const FRuntime& Runtime, float DistanceToTarget) const;
+	void EnterState(ABaseEnemy* Enemy, FRuntime& Runtime, EEnemyState NewState);
+	void UpdateState(ABaseEnemy* Enemy, FRuntime& Runtime, const UEnemyFlowFieldSubsystem* FlowField, UEnemySquadSubsystem* Squads);
+	void MoveToSquadLocation(AAIController* Controller, FRuntime& Runtime, const FVector& Location) const;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABaseEnemy>> Enemies;
+
+	TArray<FRuntime> Runtimes;
+	TMap<const ABaseEnemy*, int32> EnemyIndices;
+
+	// From 상태별 Transitions 구간 [Begin, End)
+	TArray<int32> TransitionOrder;
+	TArray<TPair<int32, int32>> TransitionRanges;
+
+	// 처리 도중 등록 목록이 바뀌어도 안전하도록 대상을 먼저 모은다 (처리 시 인덱스를 다시 찾음)
+	TArray<FScheduledUpdate> ScheduledUpdates;
+
+	// === 스케줄러 지표 ===
+	int32 NumUpdatedLastFrame = 0;
+	int32 NumDeferredLastFrame = 0;
+	int32 NumStarved = 0;
+	float LastFrameMilliseconds = 0.0f;
+	// 업데이트 간격 (초): 지난 프레임 최대, 지수 이동 평균, 전체 최대
+	float MaxLatencyLastFrame = 0.0f;
+	float AverageLatency = 0.0f;
+	float PeakLatency = 0.0f;
+};
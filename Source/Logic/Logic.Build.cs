@@ -22,7 +22,8 @@ public class Logic : ModuleRules
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[] {
-			"NavigationSystem"
+			"NavigationSystem",
+			"NetCore"
 		});
 	}
 }
@@ -1,7 +1,35 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Logic.h"
+#include "LogicStats.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_STAT(STAT_LogicLockOnTick);
+DEFINE_STAT(STAT_LogicLockOnSearch);
+DEFINE_STAT(STAT_LogicLockOnScore);
+DEFINE_STAT(STAT_LogicLockOnUpdate);
+DEFINE_STAT(STAT_LogicEnemyTick);
+DEFINE_STAT(STAT_LogicEnemySensing);
+DEFINE_STAT(STAT_LogicApplyDamage);
+DEFINE_STAT(STAT_LogicStateChange);
+DEFINE_STAT(STAT_LogicCombatTimers);
+DEFINE_STAT(STAT_LogicCombatEventFlush);
+DEFINE_STAT(STAT_LogicHealthBars);
+DEFINE_STAT(STAT_LogicFlowField);
+DEFINE_STAT(STAT_LogicEnemySpawn);
+DEFINE_STAT(STAT_LogicSquads);
+
+DEFINE_STAT(STAT_LogicNumLockOnCandidates);
+DEFINE_STAT(STAT_LogicNumEnemyTicks);
+DEFINE_STAT(STAT_LogicNumSensingEvents);
+DEFINE_STAT(STAT_LogicNumDamageEvents);
+DEFINE_STAT(STAT_LogicNumStateChanges);
+DEFINE_STAT(STAT_LogicNumCombatTimersFired);
+DEFINE_STAT(STAT_LogicNumAIUpdates);
+DEFINE_STAT(STAT_LogicNumAIDeferred);
+DEFINE_STAT(STAT_LogicNumAIStarved);
+
+UE_TRACE_CHANNEL_DEFINE(LogicCombatChannel);
+CSV_DEFINE_CATEGORY_MODULE(LOGIC_API, LogicCombat, false);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Logic, "Logic" );
- 
\ No newline at end of file
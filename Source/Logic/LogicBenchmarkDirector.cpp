@@ -0,0 +1,383 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LogicBenchmarkDirector.h"
+#include "BaseEnemy.h"
+#include "BasicSlime.h"
+#include "ScarecrowEnemy.h"
+#include "LogicCharacter.h"
+#include "CameraLockOnComponent.h"
+#include "EnemyPoolSubsystem.h"
+#include "LogicStats.h"
+#include "NavigationSystem.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+static FAutoConsoleCommandWithWorld GLogicBenchmarkRunCommand(
+	TEXT("Logic.Benchmark.Run"),
+	TEXT("전투 벤치마크를 시작합니다. 레벨에 ALogicBenchmarkDirector가 없으면 기본 설정으로 하나 만듭니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		ALogicBenchmarkDirector* Director = nullptr;
+		for (TActorIterator<ALogicBenchmarkDirector> It(World); It; ++It)
+		{
+			Director = *It;
+			break;
+		}
+
+		if (!Director)
+		{
+			Director = World->SpawnActor<ALogicBenchmarkDirector>();
+		}
+
+		if (Director)
+		{
+			Director->StartBenchmark();
+		}
+	}));
+
+ALogicBenchmarkDirector::ALogicBenchmarkDirector()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	EnemyCounts = { 50, 200, 1000 };
+	EnemyClasses = { ABasicSlime::StaticClass(), AScarecrowEnemy::StaticClass() };
+}
+
+void ALogicBenchmarkDirector::BeginPlay()
+{
+	Super::BeginPlay();
+
+	bStartedFromCommandLine = FParse::Param(FCommandLine::Get(), TEXT("LogicBenchmark"));
+	if (bRunOnBeginPlay || bStartedFromCommandLine)
+	{
+		StartBenchmark();
+	}
+}
+
+void ALogicBenchmarkDirector::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (IsRunning())
+	{
+#if CSV_PROFILER
+		if (FCsvProfiler::Get()->IsCapturing())
+		{
+			FCsvProfiler::Get()->EndCapture();
+		}
+#endif
+		ReleaseEnemies();
+		Phase = EPhase::Idle;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ALogicBenchmarkDirector::StartBenchmark()
+{
+	if (IsRunning() || GetNumConfigurations() == 0)
+	{
+		return;
+	}
+
+	Results.Reset();
+	ConfigIndex = 0;
+	SessionName = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+	RandomStream.Initialize(RandomSeed);
+
+#if CSV_PROFILER
+	FCsvProfiler::Get()->EnableCategoryByString(TEXT("LogicCombat"));
+#endif
+
+	UE_LOG(LogTemp, Log, TEXT("Logic benchmark %s: %d configurations, %.1fs each"), *SessionName, GetNumConfigurations(), WarmupTime + MeasureTime);
+
+	SetActorTickEnabled(true);
+	BeginConfiguration();
+}
+
+void ALogicBenchmarkDirector::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (Phase == EPhase::Idle)
+	{
+		return;
+	}
+
+	if (Phase == EPhase::Measure)
+	{
+		// GGameThreadTime은 직전 프레임의 게임 스레드 시간
+		GameThreadSamples.Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+		FrameTimeSum += DeltaSeconds * 1000.0;
+		CSV_CUSTOM_STAT(LogicCombat, BenchmarkEnemies, SpawnedEnemies.Num(), ECsvCustomStatOp::Set);
+		DriveLockOn(DeltaSeconds);
+	}
+
+	PhaseTimeRemaining -= DeltaSeconds;
+	if (PhaseTimeRemaining > 0.0f)
+	{
+		return;
+	}
+
+	if (Phase == EPhase::Warmup)
+	{
+		BeginMeasure();
+	}
+	else
+	{
+		EndConfiguration();
+	}
+}
+
+void ALogicBenchmarkDirector::BeginConfiguration()
+{
+	const TSubclassOf<ABaseEnemy> EnemyClass = EnemyClasses[ConfigIndex % EnemyClasses.Num()];
+	const int32 EnemyCount = EnemyCounts[ConfigIndex / EnemyClasses.Num()];
+
+	const UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this);
+	PoolMissesBeforeSpawn = Pool ? Pool->GetPoolStats(EnemyClass).Misses : 0;
+	SpawnEnemies(EnemyClass, EnemyCount);
+
+	Phase = EPhase::Warmup;
+	PhaseTimeRemaining = WarmupTime;
+}
+
+void ALogicBenchmarkDirector::BeginMeasure()
+{
+	Phase = EPhase::Measure;
+	PhaseTimeRemaining = MeasureTime;
+	TargetSwitchTimeRemaining = 0.0f;
+	GameThreadSamples.Reset();
+	FrameTimeSum = 0.0;
+
+#if CSV_PROFILER
+	const TSubclassOf<ABaseEnemy> EnemyClass = EnemyClasses[ConfigIndex % EnemyClasses.Num()];
+	const int32 EnemyCount = EnemyCounts[ConfigIndex / EnemyClasses.Num()];
+	const FString ClassName = GetNameSafe(EnemyClass.Get());
+
+	FCsvProfiler::Get()->BeginCapture(-1, FPaths::ProfilingDir() / TEXT("LogicBenchmark"),
+		FString::Printf(TEXT("%s_%s_%d.csv"), *SessionName, *ClassName, EnemyCount));
+	CSV_METADATA(TEXT("LogicEnemyClass"), *ClassName);
+	CSV_METADATA(TEXT("LogicEnemyCount"), *FString::FromInt(EnemyCount));
+#endif
+}
+
+void ALogicBenchmarkDirector::EndConfiguration()
+{
+#if CSV_PROFILER
+	if (FCsvProfiler::Get()->IsCapturing())
+	{
+		FCsvProfiler::Get()->EndCapture();
+	}
+#endif
+
+	FLogicBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+	Result.EnemyClassName = GetNameSafe(EnemyClasses[ConfigIndex % EnemyClasses.Num()].Get());
+	Result.EnemyCount = SpawnedEnemies.Num();
+	Result.NumFrames = GameThreadSamples.Num();
+
+	if (GameThreadSamples.Num() > 0)
+	{
+		double GameThreadSum = 0.0;
+		for (const float Sample : GameThreadSamples)
+		{
+			GameThreadSum += Sample;
+		}
+
+		GameThreadSamples.Sort();
+		const int32 P95Index = FMath::Clamp(FMath::FloorToInt32(0.95f * (GameThreadSamples.Num() - 1)), 0, GameThreadSamples.Num() - 1);
+
+		Result.AvgFrameMs = (float)(FrameTimeSum / GameThreadSamples.Num());
+		Result.AvgGameThreadMs = (float)(GameThreadSum / GameThreadSamples.Num());
+		Result.P95GameThreadMs = GameThreadSamples[P95Index];
+		Result.MaxGameThreadMs = GameThreadSamples.Last();
+	}
+
+	Result.UsedPhysicalMB = (float)(FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+
+	// 앞 구성의 풀 적은 반납 후에도 메모리에 남으므로 사용 메모리 차이 대신 풀 통계를 기록
+	if (const UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this))
+	{
+		Result.NewPooledEnemies = Pool->GetPoolStats(EnemyClasses[ConfigIndex % EnemyClasses.Num()]).Misses - PoolMissesBeforeSpawn;
+		for (const TSubclassOf<ABaseEnemy>& EnemyClass : EnemyClasses)
+		{
+			const FEnemyPoolStats PoolStats = Pool->GetPoolStats(EnemyClass);
+			Result.TotalPooledEnemies += PoolStats.NumFree + PoolStats.NumActive;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Logic benchmark %s x%d - Frame %.2fms, GT avg %.2fms / p95 %.2fms / max %.2fms, Mem %.1fMB, Pool +%d (total %d)"),
+		*Result.EnemyClassName, Result.EnemyCount, Result.AvgFrameMs, Result.AvgGameThreadMs, Result.P95GameThreadMs,
+		Result.MaxGameThreadMs, Result.UsedPhysicalMB, Result.NewPooledEnemies, Result.TotalPooledEnemies);
+
+	// 다음 구성 전에 락온 해제 후 적 반납
+	if (ALogicCharacter* Character = GetPlayerCharacter())
+	{
+		UCameraLockOnComponent* LockOn = Character->GetLockOnComponent();
+		if (LockOn && LockOn->IsLockedOn())
+		{
+			LockOn->ToggleLockOn();
+		}
+	}
+	ReleaseEnemies();
+
+	++ConfigIndex;
+	if (ConfigIndex < GetNumConfigurations())
+	{
+		BeginConfiguration();
+	}
+	else
+	{
+		FinishBenchmark();
+	}
+}
+
+void ALogicBenchmarkDirector::FinishBenchmark()
+{
+	Phase = EPhase::Idle;
+	SetActorTickEnabled(false);
+
+	WriteSummary();
+
+	if (bQuitWhenFinished || bStartedFromCommandLine)
+	{
+		UKismetSystemLibrary::QuitGame(this, nullptr, EQuitPreference::Quit, false);
+	}
+}
+
+void ALogicBenchmarkDirector::SpawnEnemies(TSubclassOf<ABaseEnemy> EnemyClass, int32 Count)
+{
+	UWorld* World = GetWorld();
+	if (!World || !EnemyClass)
+	{
+		return;
+	}
+
+	const ALogicCharacter* Character = GetPlayerCharacter();
+	const FVector Center = Character ? Character->GetActorLocation() : GetActorLocation();
+
+	UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this);
+	const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+
+	SpawnedEnemies.Reserve(Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		// 원판 안에서 면적 기준 균등 분포
+		const float Angle = RandomStream.FRandRange(0.0f, 2.0f * PI);
+		const float Radius = FMath::Sqrt(RandomStream.FRandRange(FMath::Square(SpawnRadiusMin), FMath::Square(SpawnRadiusMax)));
+		FVector Location = Center + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.0f);
+
+		FNavLocation NavLocation;
+		if (NavSys && NavSys->ProjectPointToNavigation(Location, NavLocation, FVector(200.0f, 200.0f, 1000.0f)))
+		{
+			Location = NavLocation.Location + FVector(0.0f, 0.0f, 100.0f);
+		}
+
+		const FTransform SpawnTransform(FRotator(0.0f, RandomStream.FRandRange(-180.0f, 180.0f), 0.0f), Location);
+
+		ABaseEnemy* Enemy = nullptr;
+		if (Pool)
+		{
+			Enemy = Pool->AcquireEnemy(EnemyClass, SpawnTransform);
+		}
+		else
+		{
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+			Enemy = World->SpawnActor<ABaseEnemy>(EnemyClass, SpawnTransform, SpawnParams);
+		}
+
+		if (Enemy)
+		{
+			SpawnedEnemies.Add(Enemy);
+		}
+	}
+}
+
+void ALogicBenchmarkDirector::ReleaseEnemies()
+{
+	UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this);
+
+	for (ABaseEnemy* Enemy : SpawnedEnemies)
+	{
+		if (!IsValid(Enemy) || Enemy->IsInPool())
+		{
+			continue;
+		}
+
+		if (Pool && Enemy->IsPooled())
+		{
+			Pool->ReleaseEnemy(Enemy);
+		}
+		else
+		{
+			Enemy->Destroy();
+		}
+	}
+	SpawnedEnemies.Reset();
+}
+
+void ALogicBenchmarkDirector::DriveLockOn(float DeltaSeconds)
+{
+	TargetSwitchTimeRemaining -= DeltaSeconds;
+	if (TargetSwitchTimeRemaining > 0.0f)
+	{
+		return;
+	}
+	TargetSwitchTimeRemaining = TargetSwitchInterval;
+
+	ALogicCharacter* Character = GetPlayerCharacter();
+	UCameraLockOnComponent* LockOn = Character ? Character->GetLockOnComponent() : nullptr;
+	if (!LockOn)
+	{
+		return;
+	}
+
+	// 락온이 안 되어 있으면 켜고, 되어 있으면 오른쪽 타겟으로 순환
+	if (!LockOn->IsLockedOn())
+	{
+		LockOn->ToggleLockOn();
+	}
+	else
+	{
+		LockOn->SwitchTarget(FVector2D(1.0f, 0.0f));
+	}
+}
+
+void ALogicBenchmarkDirector::WriteSummary() const
+{
+	FString Csv = TEXT("EnemyClass,EnemyCount,Frames,AvgFrameMs,AvgGameThreadMs,P95GameThreadMs,MaxGameThreadMs,UsedPhysicalMB,NewPooledEnemies,TotalPooledEnemies\n");
+	for (const FLogicBenchmarkResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%d,%.3f,%.3f,%.3f,%.3f,%.1f,%d,%d\n"),
+			*Result.EnemyClassName, Result.EnemyCount, Result.NumFrames, Result.AvgFrameMs, Result.AvgGameThreadMs,
+			Result.P95GameThreadMs, Result.MaxGameThreadMs, Result.UsedPhysicalMB, Result.NewPooledEnemies, Result.TotalPooledEnemies);
+	}
+
+	const FString Path = FPaths::ProfilingDir() / TEXT("LogicBenchmark") / FString::Printf(TEXT("%s_Summary.csv"), *SessionName);
+	if (FFileHelper::SaveStringToFile(Csv, *Path))
+	{
+		UE_LOG(LogTemp, Log, TEXT("Logic benchmark summary written to %s"), *Path);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Logic benchmark: failed to write %s"), *Path);
+	}
+}
+
+ALogicCharacter* ALogicBenchmarkDirector::GetPlayerCharacter() const
+{
+	return Cast<ALogicCharacter>(UGameplayStatics::GetPlayerPawn(this, 0));
+}
@@ -0,0 +1,161 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "LogicBenchmarkDirector.generated.h"
+
+class ABaseEnemy;
+class ALogicCharacter;
+
+// 벤치마크 한 구성의 측정 결과
+USTRUCT(BlueprintType)
+struct FLogicBenchmarkResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	FString EnemyClassName;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	int32 EnemyCount = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	int32 NumFrames = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	float AvgFrameMs = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	float AvgGameThreadMs = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	float P95GameThreadMs = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	float MaxGameThreadMs = 0.0f;
+
+	// 측정 종료 시점 프로세스 사용 메모리 (이전 구성의 풀 적도 포함)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	float UsedPhysicalMB = 0.0f;
+
+	// 이번 구성에서 풀이 비어 새로 만든 적 수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	int32 NewPooledEnemies = 0;
+
+	// 측정 종료 시점 모든 벤치마크 클래스의 풀 적 수 (대기 + 사용 중). 메모리 수치를 해석할 때 같이 봄
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	int32 TotalPooledEnemies = 0;
+};
+
+/**
+ * 적 수에 따른 전투 성능을 반복 측정하는 벤치마크 디렉터
+ * 벤치마크 맵에 배치하거나 Logic.Benchmark.Run 콘솔 명령으로 시작한다.
+ * 구성(적 클래스 x 적 수)마다 플레이어 주변에 풀로 적을 스폰하고, 락온을 켠 채 주기적으로 타겟을 바꾸면서
+ * 고정 시간 동안 CSV 프로파일러 캡처(LogicCombat 카테고리 포함)와 게임 스레드 시간/메모리를 기록한다.
+ * 결과 요약은 Saved/Profiling/LogicBenchmark/ 아래 CSV로 저장된다.
+ *
+ * 헤드리스 실행 예: Logic.exe /Game/ThirdPerson/Maps/ThirdPersonMap -game -nullrhi -LogicBenchmark -unattended
+ * (-LogicBenchmark가 있으면 맵에 디렉터가 없어도 ALogicGameMode가 기본 설정으로 하나 만들고, BeginPlay에서 자동 시작해 끝나면 종료)
+ */
+UCLASS()
+class LOGIC_API ALogicBenchmarkDirector : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ALogicBenchmarkDirector();
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	UFUNCTION(BlueprintCallable, Category = "Benchmark")
+	void StartBenchmark();
+
+	UFUNCTION(BlueprintPure, Category = "Benchmark")
+	bool IsRunning() const { return Phase != EPhase::Idle; }
+
+	const TArray<FLogicBenchmarkResult>& GetResults() const { return Results; }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// 구성별 적 수
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	TArray<int32> EnemyCounts;
+
+	// 구성별 적 클래스 (적 수와 조합)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	TArray<TSubclassOf<ABaseEnemy>> EnemyClasses;
+
+	// 스폰 후 측정 전 안정화 시간 (초)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	float WarmupTime = 2.0f;
+
+	// 구성당 측정 시간 (초)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	float MeasureTime = 10.0f;
+
+	// 플레이어 주변 스폰 반경
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	float SpawnRadiusMin = 400.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	float SpawnRadiusMax = 3500.0f;
+
+	// 락온 타겟 전환 주기 (초)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	float TargetSwitchInterval = 1.0f;
+
+	// true면 BeginPlay에서 바로 시작 (-LogicBenchmark 명령줄도 동일)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	bool bRunOnBeginPlay = false;
+
+	// true면 끝난 뒤 게임 종료 (-LogicBenchmark로 시작했을 때는 항상)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	bool bQuitWhenFinished = false;
+
+	// 같은 시드면 같은 스폰 배치
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Benchmark")
+	int32 RandomSeed = 1337;
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		Warmup,
+		Measure
+	};
+
+	int32 GetNumConfigurations() const { return EnemyCounts.Num() * EnemyClasses.Num(); }
+	void BeginConfiguration();
+	void BeginMeasure();
+	void EndConfiguration();
+	void FinishBenchmark();
+
+	void SpawnEnemies(TSubclassOf<ABaseEnemy> EnemyClass, int32 Count);
+	void ReleaseEnemies();
+	void DriveLockOn(float DeltaSeconds);
+	void WriteSummary() const;
+
+	ALogicCharacter* GetPlayerCharacter() const;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABaseEnemy>> SpawnedEnemies;
+
+	TArray<FLogicBenchmarkResult> Results;
+
+	// 측정 중 프레임별 게임 스레드 시간 (ms)
+	TArray<float> GameThreadSamples;
+	double FrameTimeSum = 0.0;
+	int32 PoolMissesBeforeSpawn = 0;
+
+	EPhase Phase = EPhase::Idle;
+	int32 ConfigIndex = 0;
+	float PhaseTimeRemaining = 0.0f;
+	float TargetSwitchTimeRemaining = 0.0f;
+	FRandomStream RandomStream;
+	FString SessionName;
+	bool bStartedFromCommandLine = false;
+};
@@ -2,6 +2,11 @@
 
 #include "LogicCharacter.h"
 #include "CameraLockOnComponent.h"
+#include "EnemyRegistrySubsystem.h"
+#include "EnemyHealthBarOverlay.h"
+#include "LogicReplaySubsystem.h"
+#include "LogicStats.h"
+#include "LogicMemory.h"
 #include "Engine/LocalPlayer.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -63,10 +68,39 @@ ALogicCharacter::ALogicCharacter()
 	// Create lock on component
 	LockOnComponent = CreateDefaultSubobject<UCameraLockOnComponent>(TEXT("LockOnComponent"));
 
+	HealthBarOverlayClass = UEnemyHealthBarOverlay::StaticClass();
+
 	// Note: The skeletal mesh and anim blueprint references on the Mesh component (inherited from Character) 
 	// are set in the derived blueprint asset named ThirdPersonCharacter (to avoid direct content references in C++)
 }
 
+void ALogicCharacter::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 적 AI(감지/공격 판정)가 찾을 수 있도록 플레이어로 등록
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterPlayer(this);
+	}
+}
+
+void ALogicCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (HealthBarOverlay)
+	{
+		HealthBarOverlay->RemoveFromParent();
+		HealthBarOverlay = nullptr;
+	}
+
+	if (UEnemyRegistrySubsystem* Registry = UEnemyRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterPlayer(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Input
 
@@ -81,6 +115,17 @@ void ALogicCharacter::NotifyControllerChanged()
 		{
 			Subsystem->AddMappingContext(DefaultMappingContext, 0);
 		}
+
+		// 적 체력바 오버레이 (로컬 플레이어당 하나)
+		if (PlayerController->IsLocalController() && HealthBarOverlayClass && !HealthBarOverlay)
+		{
+			LLM_SCOPE_BYTAG(Logic_HealthBar);
+			HealthBarOverlay = CreateWidget<UEnemyHealthBarOverlay>(PlayerController, HealthBarOverlayClass);
+			if (HealthBarOverlay)
+			{
+				HealthBarOverlay->AddToPlayerScreen();
+			}
+		}
 	}
 }
 
@@ -113,6 +158,8 @@ void ALogicCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComp
 
 void ALogicCharacter::Move(const FInputActionValue& Value)
 {
+	if (!ShouldHandleInput(ELogicRecordedInput::Move, Value)) return;
+
 	// input is a Vector2D
 	FVector2D MovementVector = Value.Get<FVector2D>();
 
@@ -136,6 +183,8 @@ void ALogicCharacter::Move(const FInputActionValue& Value)
 
 void ALogicCharacter::Look(const FInputActionValue& Value)
 {
+	if (!ShouldHandleInput(ELogicRecordedInput::Look, Value)) return;
+
 	// input is a Vector2D
 	FVector2D LookAxisVector = Value.Get<FVector2D>();
 
@@ -161,6 +210,8 @@ void ALogicCharacter::Look(const FInputActionValue& Value)
 
 void ALogicCharacter::LockOn(const FInputActionValue& Value)
 {
+	if (!ShouldHandleInput(ELogicRecordedInput::LockOn, Value)) return;
+
 	if (LockOnComponent)
 	{
 		LockOnComponent->ToggleLockOn();
@@ -172,6 +223,8 @@ void ALogicCharacter::LockOn(const FInputActionValue& Value)
 
 void ALogicCharacter::SwitchTarget(const FInputActionValue& Value)
 {
+	if (!ShouldHandleInput(ELogicRecordedInput::SwitchTarget, Value)) return;
+
 	if (LockOnComponent && LockOnComponent->IsLockedOn())
 	{
 		// 오른쪽 스틱 또는 방향키로 타겟 전환
@@ -188,6 +241,32 @@ void ALogicCharacter::SwitchTarget(const FInputActionValue& Value)
 	}
 }
 
+bool ALogicCharacter::ShouldHandleInput(ELogicRecordedInput Input, const FInputActionValue& Value) const
+{
+	ULogicReplaySubsystem* Replay = ULogicReplaySubsystem::Get(this);
+	return !Replay || Replay->HandleLiveInput(this, Input, Value.Get<FVector2D>());
+}
+
+void ALogicCharacter::ApplyRecordedInput(ELogicRecordedInput Input, const FVector2D& Value)
+{
+	const FInputActionValue ActionValue(Value);
+	switch (Input)
+	{
+	case ELogicRecordedInput::Move:
+		Move(ActionValue);
+		break;
+	case ELogicRecordedInput::Look:
+		Look(ActionValue);
+		break;
+	case ELogicRecordedInput::LockOn:
+		LockOn(ActionValue);
+		break;
+	case ELogicRecordedInput::SwitchTarget:
+		SwitchTarget(ActionValue);
+		break;
+	}
+}
+
 FString ALogicCharacter::GetCurrentCameraType() const
 {
 	if (CombatCamera && CombatCamera->IsActive())
@@ -203,9 +282,11 @@ FString ALogicCharacter::GetCurrentCameraType() const
 
 void ALogicCharacter::DisplayCameraDebugMessage()
 {
+#if LOGIC_WITH_DEBUG_OVERLAY
 	if (GEngine)
 	{
 		FString CameraType = GetCurrentCameraType();
 		GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Yellow, FString::Printf(TEXT("현재 카메라: %s"), *CameraType));
 	}
+#endif
 }
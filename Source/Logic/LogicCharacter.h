@@ -12,7 +12,9 @@ class UCameraComponent;
 class UInputMappingContext;
 class UInputAction;
 class UCameraLockOnComponent;
+class UEnemyHealthBarOverlay;
 struct FInputActionValue;
+enum class ELogicRecordedInput : uint8;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
 
@@ -61,8 +63,18 @@ class ALogicCharacter : public ACharacter
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Input, meta = (AllowPrivateAccess = "true"))
 	UInputAction* SwitchTargetAction;
 
+	/** 적 체력바를 한 번에 그리는 HUD 오버레이 클래스 (로컬 플레이어일 때 뷰포트에 추가) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = UI, meta = (AllowPrivateAccess = "true"))
+	TSubclassOf<UEnemyHealthBarOverlay> HealthBarOverlayClass;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UEnemyHealthBarOverlay> HealthBarOverlay;
+
 public:
 	ALogicCharacter();
+
+	/** 리플레이가 녹화된 입력을 실제 입력 처리 함수로 전달할 때 사용 */
+	void ApplyRecordedInput(ELogicRecordedInput Input, const FVector2D& Value);
 	
 
 protected:
@@ -78,10 +90,17 @@ protected:
 
 	/** Called for switch target input */
 	void SwitchTarget(const FInputActionValue& Value);
+
+	/** 입력을 리플레이 녹화에 남기고, 리플레이 재생 중인 실제 입력이면 false */
+	bool ShouldHandleInput(ELogicRecordedInput Input, const FInputActionValue& Value) const;
 			
 
 protected:
 
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void NotifyControllerChanged() override;
 
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
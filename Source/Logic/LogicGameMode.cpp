@@ -2,6 +2,10 @@
 
 #include "LogicGameMode.h"
 #include "LogicCharacter.h"
+#include "LogicBenchmarkDirector.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Misc/CommandLine.h"
 #include "UObject/ConstructorHelpers.h"
 
 ALogicGameMode::ALogicGameMode()
@@ -13,3 +17,20 @@ ALogicGameMode::ALogicGameMode()
 		DefaultPawnClass = PlayerPawnBPClass.Class;
 	}
 }
+
+void ALogicGameMode::StartPlay()
+{
+	Super::StartPlay();
+
+	// 배치된 디렉터는 자기 BeginPlay에서 이미 시작함
+	if (!FParse::Param(FCommandLine::Get(), TEXT("LogicBenchmark")))
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (World && !TActorIterator<ALogicBenchmarkDirector>(World))
+	{
+		World->SpawnActor<ALogicBenchmarkDirector>();
+	}
+}
@@ -13,6 +13,9 @@ class ALogicGameMode : public AGameModeBase
 
 public:
 	ALogicGameMode();
+
+	// -LogicBenchmark로 실행했는데 맵에 벤치마크 디렉터가 없으면 하나 만듦
+	virtual void StartPlay() override;
 };
 
 
@@ -0,0 +1,151 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LogicMemory.h"
+#include "BaseEnemy.h"
+#include "CameraLockOnComponent.h"
+#include "EnemyCrowdSubsystem.h"
+#include "AIController.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "Blueprint/UserWidget.h"
+#include "Components/WidgetComponent.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectIterator.h"
+
+LLM_DEFINE_TAG(Logic);
+LLM_DEFINE_TAG(Logic_Enemies);
+LLM_DEFINE_TAG(Logic_Enemies_BasicSlime);
+LLM_DEFINE_TAG(Logic_Enemies_Scarecrow);
+LLM_DEFINE_TAG(Logic_LockOn);
+LLM_DEFINE_TAG(Logic_HealthBar);
+
+static FAutoConsoleCommandWithWorld GLogicMemoryEnemiesCommand(
+	TEXT("Logic.Memory.Enemies"),
+	TEXT("적 클래스/등급별 개수와 대략적인 메모리 사용량을 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		UE_LOG(LogTemp, Log, TEXT("%s"), *LogicMemory::BuildEnemyMemoryReport(World));
+	}));
+
+namespace LogicMemory
+{
+	struct FMemoryRow
+	{
+		int32 NumActive = 0;
+		int32 NumPooled = 0;
+		SIZE_T Bytes = 0;
+	};
+
+	static SIZE_T CountObjectBytes(UObject* Object)
+	{
+		if (!Object)
+		{
+			return 0;
+		}
+
+		FArchiveCountMem CountMem(Object);
+		return CountMem.GetMax();
+	}
+
+	static SIZE_T CountEnemyBytes(ABaseEnemy* Enemy)
+	{
+		SIZE_T Bytes = CountObjectBytes(Enemy);
+
+		TInlineComponentArray<UActorComponent*> Components(Enemy);
+		for (UActorComponent* Component : Components)
+		{
+			Bytes += CountObjectBytes(Component);
+
+			if (const UWidgetComponent* Widget = Cast<UWidgetComponent>(Component))
+			{
+				Bytes += CountObjectBytes(Widget->GetWidget());
+			}
+		}
+
+		if (AAIController* Controller = Cast<AAIController>(Enemy->GetController()))
+		{
+			Bytes += CountObjectBytes(Controller);
+			Bytes += CountObjectBytes(Controller->GetBlackboardComponent());
+			Bytes += CountObjectBytes(Controller->GetBrainComponent());
+		}
+
+		return Bytes;
+	}
+
+	static void AppendRow(FString& Result, const FString& Name, const FMemoryRow& Row)
+	{
+		const int32 NumTotal = Row.NumActive + Row.NumPooled;
+		Result += FString::Printf(TEXT("\n  %-32s Active: %4d, Pooled: %4d, Total: %8.1f KB, Per Enemy: %6.1f KB"),
+			*Name, Row.NumActive, Row.NumPooled,
+			Row.Bytes / 1024.0, NumTotal > 0 ? Row.Bytes / 1024.0 / NumTotal : 0.0);
+	}
+
+	FString BuildEnemyMemoryReport(UWorld* World)
+	{
+		if (!World)
+		{
+			return TEXT("Logic Memory - no world");
+		}
+
+		TMap<UClass*, FMemoryRow> ByClass;
+		TMap<EEnemyRank, FMemoryRow> ByRank;
+		FMemoryRow Total;
+
+		for (TActorIterator<ABaseEnemy> It(World); It; ++It)
+		{
+			ABaseEnemy* Enemy = *It;
+			const SIZE_T Bytes = CountEnemyBytes(Enemy);
+
+			for (FMemoryRow* Row : { &ByClass.FindOrAdd(Enemy->GetClass()), &ByRank.FindOrAdd(Enemy->EnemyRank), &Total })
+			{
+				if (Enemy->IsInPool())
+				{
+					++Row->NumPooled;
+				}
+				else
+				{
+					++Row->NumActive;
+				}
+				Row->Bytes += Bytes;
+			}
+		}
+
+		FString Result = TEXT("Logic Memory - Enemies by class");
+		for (const TPair<UClass*, FMemoryRow>& Pair : ByClass)
+		{
+			AppendRow(Result, GetNameSafe(Pair.Key), Pair.Value);
+		}
+
+		Result += TEXT("\nEnemies by rank");
+		for (const TPair<EEnemyRank, FMemoryRow>& Pair : ByRank)
+		{
+			AppendRow(Result, UEnum::GetDisplayValueAsText(Pair.Key).ToString(), Pair.Value);
+		}
+
+		Result += TEXT("\nTotal");
+		AppendRow(Result, TEXT("All enemies"), Total);
+
+		// 액터가 없는 크라우드 프록시
+		if (const UEnemyCrowdSubsystem* Crowd = UEnemyCrowdSubsystem::Get(World))
+		{
+			Result += FString::Printf(TEXT("\nCrowd proxies: %d (%.1f KB)"),
+				Crowd->GetNumProxies(), Crowd->GetNumProxies() * sizeof(FEnemyCrowdProxy) / 1024.0);
+		}
+
+		// 플레이어 락온 컴포넌트
+		int32 NumLockOn = 0;
+		SIZE_T LockOnBytes = 0;
+		for (TObjectIterator<UCameraLockOnComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World)
+			{
+				++NumLockOn;
+				LockOnBytes += CountObjectBytes(*It);
+			}
+		}
+		Result += FString::Printf(TEXT("\nLock-on components: %d (%.1f KB)"), NumLockOn, LockOnBytes / 1024.0);
+
+		return Result;
+	}
+}
@@ -0,0 +1,23 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+// === LLM 태그 (-llm, stat LLMFULL / Insights Memory에서 Logic/... 로 표시) ===
+LLM_DECLARE_TAG_API(Logic, LOGIC_API);
+LLM_DECLARE_TAG_API(Logic_Enemies, LOGIC_API);
+LLM_DECLARE_TAG_API(Logic_Enemies_BasicSlime, LOGIC_API);
+LLM_DECLARE_TAG_API(Logic_Enemies_Scarecrow, LOGIC_API);
+LLM_DECLARE_TAG_API(Logic_LockOn, LOGIC_API);
+LLM_DECLARE_TAG_API(Logic_HealthBar, LOGIC_API);
+
+class UWorld;
+
+namespace LogicMemory
+{
+	// 월드의 적을 클래스/등급별로 모아 개수와 대략적인 메모리 사용량을 정리 (Logic.Memory.Enemies)
+	// 액터, 컴포넌트, AIController, 블랙보드를 FArchiveCountMem으로 합산한다.
+	LOGIC_API FString BuildEnemyMemoryReport(UWorld* World);
+}
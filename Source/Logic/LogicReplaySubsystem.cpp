@@ -0,0 +1,649 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LogicReplaySubsystem.h"
+#include "LogicCharacter.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace LogicReplay
+{
+	constexpr uint32 Magic = 0x5052434C; // "LCRP"
+	constexpr int32 Version = 1;
+
+	// 히스토그램 구간 (0.5ms x 200칸, 마지막 칸은 100ms 이상)
+	constexpr float BucketMs = 0.5f;
+	constexpr int32 NumBuckets = 201;
+
+	FORCEINLINE uint8 GetInputBit(ELogicRecordedInput Input)
+	{
+		return uint8(1) << (uint8)Input;
+	}
+
+	float GetPercentile(const TArray<float>& SortedSamples, float Percent)
+	{
+		if (SortedSamples.Num() == 0)
+		{
+			return 0.0f;
+		}
+		const int32 Index = FMath::Clamp(FMath::CeilToInt32(SortedSamples.Num() * Percent) - 1, 0, SortedSamples.Num() - 1);
+		return SortedSamples[Index];
+	}
+
+	float GetAverage(const TArray<float>& Samples)
+	{
+		double Sum = 0.0;
+		for (const float Sample : Samples)
+		{
+			Sum += Sample;
+		}
+		return Samples.Num() > 0 ? (float)(Sum / Samples.Num()) : 0.0f;
+	}
+
+	// "Key,Value" 요약 줄만 읽음 (BucketMs 헤더에서 멈춤)
+	bool LoadSummary(const FString& Path, TArray<TPair<FString, float>>& OutValues)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *Path))
+		{
+			return false;
+		}
+
+		for (const FString& Line : Lines)
+		{
+			FString Key;
+			FString Value;
+			if (!Line.Split(TEXT(","), &Key, &Value))
+			{
+				continue;
+			}
+			if (Key == TEXT("BucketMs"))
+			{
+				break;
+			}
+			if (Value.IsNumeric())
+			{
+				OutValues.Emplace(Key, FCString::Atof(*Value));
+			}
+		}
+		return true;
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GLogicReplayRecordCommand(
+	TEXT("Logic.Replay.Record"),
+	TEXT("현재 맵을 다시 열고 처음부터 입력을 녹화합니다. 사용법: Logic.Replay.Record <이름>"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		ULogicReplaySubsystem::OpenLevelForRecording(World, Args.Num() > 0 ? Args[0] : FString());
+	}));
+
+static FAutoConsoleCommandWithWorld GLogicReplayStopCommand(
+	TEXT("Logic.Replay.Stop"),
+	TEXT("입력 녹화를 끝내고 파일로 저장합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (ULogicReplaySubsystem* Replay = ULogicReplaySubsystem::Get(World))
+		{
+			Replay->StopRecording();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GLogicReplayPlayCommand(
+	TEXT("Logic.Replay.Play"),
+	TEXT("녹화 파일의 맵을 다시 열고 고정 틱으로 재생합니다. 사용법: Logic.Replay.Play <이름>"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (Args.Num() > 0)
+		{
+			ULogicReplaySubsystem::OpenLevelForReplay(World, Args[0]);
+		}
+	}));
+
+static FAutoConsoleCommand GLogicReplayDiffCommand(
+	TEXT("Logic.Replay.Diff"),
+	TEXT("두 리플레이 히스토그램 CSV의 요약 수치를 비교합니다. 사용법: Logic.Replay.Diff <기준.csv> <비교.csv>"),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+	{
+		if (Args.Num() >= 2)
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *ULogicReplaySubsystem::DiffHistograms(Args[0], Args[1]));
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld GLogicReplayStatsCommand(
+	TEXT("Logic.Replay.Stats"),
+	TEXT("녹화/재생 상태를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const ULogicReplaySubsystem* Replay = ULogicReplaySubsystem::Get(World))
+		{
+			UE_LOG(LogTemp, Log, TEXT("%s"), *Replay->GetStatsString());
+		}
+	}));
+
+ULogicReplaySubsystem* ULogicReplaySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<ULogicReplaySubsystem>() : nullptr;
+}
+
+bool ULogicReplaySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void ULogicReplaySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 녹화/재생이 아니면 매번 다른 시드
+	Seed = FMath::Rand();
+	CombatRandom.Initialize(Seed);
+
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &ULogicReplaySubsystem::HandlePreActorTick);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ULogicReplaySubsystem::HandlePostActorTick);
+}
+
+void ULogicReplaySubsystem::Deinitialize()
+{
+	if (IsRecording())
+	{
+		StopRecording();
+	}
+	else if (IsReplaying())
+	{
+		RestoreTimeStep();
+		Mode = EMode::None;
+	}
+
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+	Super::Deinitialize();
+}
+
+void ULogicReplaySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 액터 BeginPlay(슬라임 바운스 타이머 등)보다 먼저 시드를 맞춰야 하므로 여기서 시작
+	FString Name;
+	if (const TCHAR* Option = InWorld.URL.GetOption(TEXT("LogicReplay="), nullptr))
+	{
+		StartReplay(Option);
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("-LogicReplay="), Name))
+	{
+		bQuitWhenFinished = StartReplay(Name);
+	}
+	else if (const TCHAR* RecordOption = InWorld.URL.GetOption(TEXT("LogicRecord="), nullptr))
+	{
+		StartRecording(RecordOption);
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("-LogicRecord="), Name))
+	{
+		StartRecording(Name);
+	}
+}
+
+float ULogicReplaySubsystem::RandRange(const UObject* WorldContextObject, float Min, float Max)
+{
+	if (ULogicReplaySubsystem* Replay = Get(WorldContextObject))
+	{
+		return Replay->CombatRandom.FRandRange(Min, Max);
+	}
+	return FMath::FRandRange(Min, Max);
+}
+
+bool ULogicReplaySubsystem::RandBool(const UObject* WorldContextObject)
+{
+	if (ULogicReplaySubsystem* Replay = Get(WorldContextObject))
+	{
+		return Replay->CombatRandom.FRand() < 0.5f;
+	}
+	return FMath::RandBool();
+}
+
+// === 녹화 ===
+
+void ULogicReplaySubsystem::OpenLevelForRecording(UWorld* World, const FString& ReplayName)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	const FString Name = ReplayName.IsEmpty() ? FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")) : ReplayName;
+	UGameplayStatics::OpenLevel(World, FName(*UWorld::RemovePIEPrefix(World->GetMapName())), true, FString::Printf(TEXT("LogicRecord=%s"), *Name));
+}
+
+void ULogicReplaySubsystem::StartRecording(const FString& InReplayName)
+{
+	ReplayName = InReplayName;
+	Mode = EMode::Recording;
+
+	Seed = FMath::Rand();
+	CombatRandom.Initialize(Seed);
+	// 엔진 쪽 전역 난수(내비메시 랜덤 지점 등)도 같은 시드로
+	FMath::RandInit(Seed);
+	FMath::SRandInit(Seed);
+
+	CurrentFrame = FRecordedFrame();
+	Frames.Reset();
+
+	UE_LOG(LogTemp, Log, TEXT("Logic replay: recording '%s' (seed %d)"), *ReplayName, Seed);
+}
+
+void ULogicReplaySubsystem::StopRecording()
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+	Mode = EMode::None;
+
+	const UWorld* World = GetWorld();
+	FString MapName = World ? UWorld::RemovePIEPrefix(World->GetMapName()) : FString();
+	uint32 FileMagic = LogicReplay::Magic;
+	int32 FileVersion = LogicReplay::Version;
+	int32 NumFrames = Frames.Num();
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << FileMagic << FileVersion << Seed << MapName << NumFrames;
+	for (FRecordedFrame& Frame : Frames)
+	{
+		SerializeFrame(Writer, Frame);
+	}
+
+	const FString Path = GetReplayPath(ReplayName);
+	if (FFileHelper::SaveArrayToFile(Bytes, *Path))
+	{
+		UE_LOG(LogTemp, Log, TEXT("Logic replay: saved %d frames (%d bytes) to %s"), NumFrames, Bytes.Num(), *Path);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Logic replay: failed to write %s"), *Path);
+	}
+
+	Frames.Empty();
+}
+
+bool ULogicReplaySubsystem::HandleLiveInput(const ALogicCharacter* Character, ELogicRecordedInput Input, const FVector2D& Value)
+{
+	if (bApplyingReplayInput)
+	{
+		return true;
+	}
+	if (IsReplaying())
+	{
+		// 재생 중에는 실제 입력을 버림
+		return false;
+	}
+	if (!IsRecording() || Character != GetPlayerCharacter())
+	{
+		return true;
+	}
+
+	// 한 프레임에 여러 번 들어오면 이동/시선은 합산 (둘 다 선형 누적), 락온은 토글이므로 짝수 번이면 상쇄
+	const FVector2f Value2f(Value);
+	const uint8 InputBit = LogicReplay::GetInputBit(Input);
+	switch (Input)
+	{
+	case ELogicRecordedInput::Move:
+		CurrentFrame.Flags |= InputBit;
+		CurrentFrame.Move += Value2f;
+		break;
+	case ELogicRecordedInput::Look:
+		CurrentFrame.Flags |= InputBit;
+		CurrentFrame.Look += Value2f;
+		break;
+	case ELogicRecordedInput::LockOn:
+		CurrentFrame.Flags ^= InputBit;
+		break;
+	case ELogicRecordedInput::SwitchTarget:
+		CurrentFrame.Flags |= InputBit;
+		CurrentFrame.SwitchDirection = Value2f;
+		break;
+	}
+	return true;
+}
+
+// === 재생 ===
+
+void ULogicReplaySubsystem::OpenLevelForReplay(UWorld* World, const FString& ReplayName)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	// 녹화한 맵으로 열어야 하므로 헤더에서 맵 이름을 읽음
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetReplayPath(ReplayName)))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Logic replay: cannot read %s"), *GetReplayPath(ReplayName));
+		return;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 FileMagic = 0;
+	int32 FileVersion = 0;
+	int32 FileSeed = 0;
+	FString MapName;
+	Reader << FileMagic << FileVersion << FileSeed << MapName;
+	if (Reader.IsError() || FileMagic != LogicReplay::Magic || MapName.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Logic replay: %s is not a replay file"), *ReplayName);
+		return;
+	}
+
+	UGameplayStatics::OpenLevel(World, FName(*MapName), true, FString::Printf(TEXT("LogicReplay=%s"), *ReplayName));
+}
+
+bool ULogicReplaySubsystem::StartReplay(const FString& InReplayName)
+{
+	TArray<uint8> Bytes;
+	const FString Path = GetReplayPath(InReplayName);
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Logic replay: cannot read %s"), *Path);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 FileMagic = 0;
+	int32 FileVersion = 0;
+	int32 FileSeed = 0;
+	FString MapName;
+	int32 NumFrames = 0;
+	Reader << FileMagic << FileVersion << FileSeed << MapName << NumFrames;
+	if (Reader.IsError() || FileMagic != LogicReplay::Magic || FileVersion != LogicReplay::Version || NumFrames <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Logic replay: %s has an unsupported header"), *Path);
+		return false;
+	}
+
+	const UWorld* World = GetWorld();
+	if (World && MapName != UWorld::RemovePIEPrefix(World->GetMapName()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Logic replay: %s was recorded on %s, playing on %s"), *InReplayName, *MapName, *World->GetMapName());
+	}
+
+	Frames.SetNum(NumFrames);
+	for (FRecordedFrame& Frame : Frames)
+	{
+		SerializeFrame(Reader, Frame);
+	}
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Logic replay: %s is truncated"), *Path);
+		Frames.Empty();
+		return false;
+	}
+
+	ReplayName = InReplayName;
+	Mode = EMode::Replaying;
+	Seed = FileSeed;
+	CombatRandom.Initialize(Seed);
+	FMath::RandInit(Seed);
+	FMath::SRandInit(Seed);
+
+	ReplayFrameIndex = 0;
+	GameThreadSamples.Reset(NumFrames);
+	FrameSamples.Reset(NumFrames);
+	LastFrameStartTime = 0.0;
+	ReplayStartTime = FPlatformTime::Seconds();
+
+	// 녹화된 DeltaTime을 고정 틱으로 사용 (대기 없이 최대한 빨리 진행)
+	bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+	PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+	SetFixedDeltaTime(Frames[0].DeltaSeconds);
+
+	UE_LOG(LogTemp, Log, TEXT("Logic replay: playing '%s' (%d frames, seed %d)"), *ReplayName, NumFrames, Seed);
+	return true;
+}
+
+void ULogicReplaySubsystem::FinishReplay()
+{
+	Mode = EMode::None;
+	RestoreTimeStep();
+
+	const double WallSeconds = FPlatformTime::Seconds() - ReplayStartTime;
+	double SimulatedSeconds = 0.0;
+	for (const FRecordedFrame& Frame : Frames)
+	{
+		SimulatedSeconds += Frame.DeltaSeconds;
+	}
+	UE_LOG(LogTemp, Log, TEXT("Logic replay: '%s' finished - %d frames, %.1fs simulated in %.1fs"),
+		*ReplayName, Frames.Num(), SimulatedSeconds, WallSeconds);
+
+	WriteHistogram();
+	Frames.Empty();
+
+	if (bQuitWhenFinished)
+	{
+		UKismetSystemLibrary::QuitGame(this, nullptr, EQuitPreference::Quit, false);
+	}
+}
+
+void ULogicReplaySubsystem::HandlePreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld())
+	{
+		return;
+	}
+
+	if (IsRecording())
+	{
+		// 이번 프레임 입력은 액터 Tick(플레이어 컨트롤러 입력 처리) 중에 모임
+		CurrentFrame = FRecordedFrame();
+		CurrentFrame.DeltaSeconds = (float)FApp::GetDeltaTime();
+	}
+	else if (IsReplaying())
+	{
+		if (!Frames.IsValidIndex(ReplayFrameIndex))
+		{
+			FinishReplay();
+			return;
+		}
+
+		// GGameThreadTime은 직전 프레임의 게임 스레드 시간
+		const double Now = FPlatformTime::Seconds();
+		if (LastFrameStartTime > 0.0)
+		{
+			FrameSamples.Add((float)((Now - LastFrameStartTime) * 1000.0));
+			GameThreadSamples.Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+		}
+		LastFrameStartTime = Now;
+
+		ApplyFrame(Frames[ReplayFrameIndex]);
+	}
+}
+
+void ULogicReplaySubsystem::HandlePostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld())
+	{
+		return;
+	}
+
+	if (IsRecording())
+	{
+		Frames.Add(CurrentFrame);
+	}
+	else if (IsReplaying())
+	{
+		// 다음 프레임의 DeltaTime을 미리 설정
+		++ReplayFrameIndex;
+		if (Frames.IsValidIndex(ReplayFrameIndex))
+		{
+			SetFixedDeltaTime(Frames[ReplayFrameIndex].DeltaSeconds);
+		}
+	}
+}
+
+void ULogicReplaySubsystem::ApplyFrame(const FRecordedFrame& Frame)
+{
+	ALogicCharacter* Character = GetPlayerCharacter();
+	if (!Character || Frame.Flags == 0)
+	{
+		return;
+	}
+
+	TGuardValue<bool> ApplyingGuard(bApplyingReplayInput, true);
+
+	if (Frame.Flags & LogicReplay::GetInputBit(ELogicRecordedInput::Move))
+	{
+		Character->ApplyRecordedInput(ELogicRecordedInput::Move, FVector2D(Frame.Move));
+	}
+	if (Frame.Flags & LogicReplay::GetInputBit(ELogicRecordedInput::Look))
+	{
+		Character->ApplyRecordedInput(ELogicRecordedInput::Look, FVector2D(Frame.Look));
+	}
+	if (Frame.Flags & LogicReplay::GetInputBit(ELogicRecordedInput::LockOn))
+	{
+		Character->ApplyRecordedInput(ELogicRecordedInput::LockOn, FVector2D(1.0f, 0.0f));
+	}
+	if (Frame.Flags & LogicReplay::GetInputBit(ELogicRecordedInput::SwitchTarget))
+	{
+		Character->ApplyRecordedInput(ELogicRecordedInput::SwitchTarget, FVector2D(Frame.SwitchDirection));
+	}
+}
+
+void ULogicReplaySubsystem::SetFixedDeltaTime(float DeltaSeconds)
+{
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(FMath::Max<double>(DeltaSeconds, UE_KINDA_SMALL_NUMBER));
+}
+
+void ULogicReplaySubsystem::RestoreTimeStep()
+{
+	FApp::SetUseFixedTimeStep(bPreviousUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+}
+
+void ULogicReplaySubsystem::WriteHistogram() const
+{
+	TArray<float> SortedGameThread = GameThreadSamples;
+	TArray<float> SortedFrame = FrameSamples;
+	SortedGameThread.Sort();
+	SortedFrame.Sort();
+
+	FString Csv = TEXT("Metric,Value\n");
+	Csv += FString::Printf(TEXT("Frames,%d\n"), SortedFrame.Num());
+	Csv += FString::Printf(TEXT("Seed,%d\n"), Seed);
+	Csv += FString::Printf(TEXT("GameThreadAvgMs,%.3f\nGameThreadP50Ms,%.3f\nGameThreadP95Ms,%.3f\nGameThreadP99Ms,%.3f\nGameThreadMaxMs,%.3f\n"),
+		LogicReplay::GetAverage(SortedGameThread), LogicReplay::GetPercentile(SortedGameThread, 0.5f), LogicReplay::GetPercentile(SortedGameThread, 0.95f),
+		LogicReplay::GetPercentile(SortedGameThread, 0.99f), SortedGameThread.Num() > 0 ? SortedGameThread.Last() : 0.0f);
+	Csv += FString::Printf(TEXT("FrameAvgMs,%.3f\nFrameP50Ms,%.3f\nFrameP95Ms,%.3f\nFrameP99Ms,%.3f\nFrameMaxMs,%.3f\n"),
+		LogicReplay::GetAverage(SortedFrame), LogicReplay::GetPercentile(SortedFrame, 0.5f), LogicReplay::GetPercentile(SortedFrame, 0.95f),
+		LogicReplay::GetPercentile(SortedFrame, 0.99f), SortedFrame.Num() > 0 ? SortedFrame.Last() : 0.0f);
+
+	TArray<int32> GameThreadBuckets;
+	TArray<int32> FrameBuckets;
+	GameThreadBuckets.Init(0, LogicReplay::NumBuckets);
+	FrameBuckets.Init(0, LogicReplay::NumBuckets);
+	for (const float Sample : SortedGameThread)
+	{
+		++GameThreadBuckets[FMath::Min(FMath::FloorToInt32(Sample / LogicReplay::BucketMs), LogicReplay::NumBuckets - 1)];
+	}
+	for (const float Sample : SortedFrame)
+	{
+		++FrameBuckets[FMath::Min(FMath::FloorToInt32(Sample / LogicReplay::BucketMs), LogicReplay::NumBuckets - 1)];
+	}
+
+	Csv += TEXT("BucketMs,GameThreadFrames,Frames\n");
+	for (int32 Bucket = 0; Bucket < LogicReplay::NumBuckets; ++Bucket)
+	{
+		if (GameThreadBuckets[Bucket] > 0 || FrameBuckets[Bucket] > 0)
+		{
+			Csv += FString::Printf(TEXT("%.1f,%d,%d\n"), Bucket * LogicReplay::BucketMs, GameThreadBuckets[Bucket], FrameBuckets[Bucket]);
+		}
+	}
+
+	const FString Path = FPaths::ProfilingDir() / TEXT("LogicReplay") / FString::Printf(TEXT("%s_%s.csv"), *ReplayName, *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	if (FFileHelper::SaveStringToFile(Csv, *Path))
+	{
+		UE_LOG(LogTemp, Log, TEXT("Logic replay histogram written to %s"), *Path);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Logic replay: failed to write %s"), *Path);
+	}
+}
+
+FString ULogicReplaySubsystem::DiffHistograms(const FString& BaselinePath, const FString& ComparePath)
+{
+	TArray<TPair<FString, float>> Baseline;
+	TArray<TPair<FString, float>> Compare;
+	if (!LogicReplay::LoadSummary(BaselinePath, Baseline) || !LogicReplay::LoadSummary(ComparePath, Compare))
+	{
+		return FString::Printf(TEXT("Logic replay diff: cannot read %s or %s"), *BaselinePath, *ComparePath);
+	}
+
+	FString Result = FString::Printf(TEXT("Logic replay diff (%s -> %s)"), *FPaths::GetCleanFilename(BaselinePath), *FPaths::GetCleanFilename(ComparePath));
+	for (const TPair<FString, float>& Base : Baseline)
+	{
+		const TPair<FString, float>* Other = Compare.FindByPredicate([&Base](const TPair<FString, float>& Pair) { return Pair.Key == Base.Key; });
+		if (!Other || Base.Key == TEXT("Seed"))
+		{
+			continue;
+		}
+
+		const float Delta = Other->Value - Base.Value;
+		const float Percent = !FMath::IsNearlyZero(Base.Value) ? Delta / Base.Value * 100.0f : 0.0f;
+		Result += FString::Printf(TEXT("\n  %-16s %10.3f -> %10.3f  (%+.3f, %+.1f%%)"), *Base.Key, Base.Value, Other->Value, Delta, Percent);
+	}
+	return Result;
+}
+
+// === 공통 ===
+
+void ULogicReplaySubsystem::SerializeFrame(FArchive& Ar, FRecordedFrame& Frame)
+{
+	Ar << Frame.DeltaSeconds << Frame.Flags;
+	if (Frame.Flags & LogicReplay::GetInputBit(ELogicRecordedInput::Move))
+	{
+		Ar << Frame.Move;
+	}
+	if (Frame.Flags & LogicReplay::GetInputBit(ELogicRecordedInput::Look))
+	{
+		Ar << Frame.Look;
+	}
+	if (Frame.Flags & LogicReplay::GetInputBit(ELogicRecordedInput::SwitchTarget))
+	{
+		Ar << Frame.SwitchDirection;
+	}
+}
+
+FString ULogicReplaySubsystem::GetReplayPath(const FString& ReplayName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("Replays") / TEXT("Logic") / (FPaths::GetBaseFilename(ReplayName) + TEXT(".lcr"));
+}
+
+ALogicCharacter* ULogicReplaySubsystem::GetPlayerCharacter() const
+{
+	return Cast<ALogicCharacter>(UGameplayStatics::GetPlayerPawn(this, 0));
+}
+
+FString ULogicReplaySubsystem::GetStatsString() const
+{
+	switch (Mode)
+	{
+	case EMode::Recording:
+		return FString::Printf(TEXT("Logic Replay - Recording '%s', Frames: %d, Seed: %d"), *ReplayName, Frames.Num(), Seed);
+	case EMode::Replaying:
+		return FString::Printf(TEXT("Logic Replay - Playing '%s', Frame: %d / %d, Seed: %d"), *ReplayName, ReplayFrameIndex, Frames.Num(), Seed);
+	default:
+		return FString::Printf(TEXT("Logic Replay - Idle, Seed: %d"), Seed);
+	}
+}
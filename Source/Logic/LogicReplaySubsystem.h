@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "LogicReplaySubsystem.generated.h"
+
+class ALogicCharacter;
+
+// 녹화되는 플레이어 입력 종류
+UENUM()
+enum class ELogicRecordedInput : uint8
+{
+	Move,
+	Look,
+	LockOn,
+	SwitchTarget
+};
+
+/**
+ * 전투 재현용 입력 녹화/고정 틱 리플레이 서브시스템
+ * 녹화 중에는 첫 번째 플레이어 ALogicCharacter의 Move/Look/LockOn/SwitchTarget 입력과 프레임 DeltaTime을
+ * 프레임 단위 바이너리 스트림(Saved/Replays/Logic/<이름>.lcr)에 기록한다. 전투 난수(GetCombatRandom)는
+ * 녹화 시드로 시작하므로 같은 맵에서 같은 입력/같은 DeltaTime으로 다시 돌리면 같은 전투가 재현된다.
+ * 리플레이는 실제 입력을 무시하고 녹화된 DeltaTime을 고정 틱으로 사용해 실시간보다 빠르게 돌며,
+ * 끝나면 게임 스레드/프레임 시간 히스토그램을 Saved/Profiling/LogicReplay/에 CSV로 남긴다.
+ *
+ * 맵 시작부터 녹화/재생해야 재현되므로 URL 옵션이나 명령줄로 시작한다.
+ *   녹화: Logic.Replay.Record <이름> 또는 -LogicRecord=<이름>
+ *   재생: Logic.Replay.Play <이름> 또는 -LogicReplay=<이름> (명령줄로 시작하면 끝난 뒤 종료)
+ *   비교: Logic.Replay.Diff <A.csv> <B.csv>
+ */
+UCLASS()
+class LOGIC_API ULogicReplaySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	static ULogicReplaySubsystem* Get(const UObject* WorldContextObject);
+
+	// 전투 로직이 쓰는 난수. 녹화/재생 중에는 녹화 시드로 시작한 스트림 (서브시스템이 없으면 전역 난수)
+	static float RandRange(const UObject* WorldContextObject, float Min, float Max);
+	static bool RandBool(const UObject* WorldContextObject);
+
+	bool IsRecording() const { return Mode == EMode::Recording; }
+	bool IsReplaying() const { return Mode == EMode::Replaying; }
+
+	// 녹화 중이면 입력을 현재 프레임에 기록. 리플레이 중이면 실제 입력을 버리도록 false 반환
+	bool HandleLiveInput(const ALogicCharacter* Character, ELogicRecordedInput Input, const FVector2D& Value);
+
+	// 녹화를 끝내고 파일로 저장
+	void StopRecording();
+
+	// 현재 맵을 다시 열면서 녹화/재생 시작
+	static void OpenLevelForRecording(UWorld* World, const FString& ReplayName);
+	static void OpenLevelForReplay(UWorld* World, const FString& ReplayName);
+
+	// 두 히스토그램 CSV의 평균/백분위 차이
+	static FString DiffHistograms(const FString& BaselinePath, const FString& ComparePath);
+
+	FString GetStatsString() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	enum class EMode : uint8
+	{
+		None,
+		Recording,
+		Replaying
+	};
+
+	// 프레임 하나의 입력 (Flags 비트가 켜진 입력만 직렬화)
+	struct FRecordedFrame
+	{
+		float DeltaSeconds = 0.0f;
+		uint8 Flags = 0;
+		FVector2f Move = FVector2f::ZeroVector;
+		FVector2f Look = FVector2f::ZeroVector;
+		FVector2f SwitchDirection = FVector2f::ZeroVector;
+	};
+
+	void StartRecording(const FString& ReplayName);
+	bool StartReplay(const FString& ReplayName);
+	void FinishReplay();
+
+	void HandlePreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+	void HandlePostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	void ApplyFrame(const FRecordedFrame& Frame);
+	void SetFixedDeltaTime(float DeltaSeconds);
+	void RestoreTimeStep();
+	void WriteHistogram() const;
+
+	ALogicCharacter* GetPlayerCharacter() const;
+
+	static FString GetReplayPath(const FString& ReplayName);
+	static void SerializeFrame(FArchive& Ar, FRecordedFrame& Frame);
+
+	EMode Mode = EMode::None;
+	FString ReplayName;
+	FRandomStream CombatRandom;
+	int32 Seed = 0;
+
+	// 녹화: 현재 프레임에 모으는 입력과 지금까지의 프레임
+	FRecordedFrame CurrentFrame;
+	TArray<FRecordedFrame> Frames;
+
+	// 재생 위치와 측정값
+	int32 ReplayFrameIndex = 0;
+	bool bApplyingReplayInput = false;
+	bool bQuitWhenFinished = false;
+	bool bPreviousUseFixedTimeStep = false;
+	double PreviousFixedDeltaTime = 0.0;
+	double LastFrameStartTime = 0.0;
+	double ReplayStartTime = 0.0;
+	TArray<float> GameThreadSamples;
+	TArray<float> FrameSamples;
+
+	FDelegateHandle PreActorTickHandle;
+	FDelegateHandle PostActorTickHandle;
+};
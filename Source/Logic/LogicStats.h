@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// 화면 디버그 출력 (Shipping/Test 빌드에서는 컴파일되지 않음)
+#define LOGIC_WITH_DEBUG_OVERLAY !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+// === 전투/AI 통계 (stat LogicCombat) ===
+DECLARE_STATS_GROUP(TEXT("LogicCombat"), STATGROUP_LogicCombat, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LockOn Tick"), STAT_LogicLockOnTick, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LockOn Search"), STAT_LogicLockOnSearch, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LockOn Score"), STAT_LogicLockOnScore, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LockOn Update Camera"), STAT_LogicLockOnUpdate, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Tick"), STAT_LogicEnemyTick, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Sensing"), STAT_LogicEnemySensing, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Apply Damage"), STAT_LogicApplyDamage, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy State Change"), STAT_LogicStateChange, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Combat Timers"), STAT_LogicCombatTimers, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Combat Event Flush"), STAT_LogicCombatEventFlush, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Health Bar Overlay"), STAT_LogicHealthBars, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Flow Field"), STAT_LogicFlowField, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Spawn Queue"), STAT_LogicEnemySpawn, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Squads"), STAT_LogicSquads, STATGROUP_LogicCombat, LOGIC_API);
+
+// 프레임마다 0으로 초기화되는 카운터
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LockOn Candidates"), STAT_LogicNumLockOnCandidates, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Enemy Ticks"), STAT_LogicNumEnemyTicks, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sensing Events"), STAT_LogicNumSensingEvents, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Events"), STAT_LogicNumDamageEvents, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("State Changes"), STAT_LogicNumStateChanges, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Combat Timers Fired"), STAT_LogicNumCombatTimersFired, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Updates"), STAT_LogicNumAIUpdates, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Deferred"), STAT_LogicNumAIDeferred, STATGROUP_LogicCombat, LOGIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Starved"), STAT_LogicNumAIStarved, STATGROUP_LogicCombat, LOGIC_API);
+
+// Insights 트레이스 채널 (-trace=cpu,LogicCombat)
+UE_TRACE_CHANNEL_EXTERN(LogicCombatChannel, LOGIC_API);
+
+// CSV 프로파일러 카테고리 (기본 꺼짐, -csvCategories=LogicCombat 또는 벤치마크에서 켬)
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(LOGIC_API, LogicCombat);
+
+// stat 사이클 카운터, CSV 타이밍, Insights 이벤트를 같은 이름으로 기록
+#define LOGIC_COMBAT_SCOPE(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	CSV_SCOPED_TIMING_STAT(LogicCombat, Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#Stat, LogicCombatChannel)
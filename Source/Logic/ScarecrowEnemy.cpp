@@ -1,21 +1,17 @@
 #include "ScarecrowEnemy.h"
+#include "LogicMemory.h"
 #include "Engine/World.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 AScarecrowEnemy::AScarecrowEnemy()
 {
+    LLM_SCOPE_BYTAG(Logic_Enemies_Scarecrow);
+
     // 기본적으로 AI 비활성화
     bCanAttack = false;
     bIsDead = false;
 }
 
-void AScarecrowEnemy::BeginPlay()
-{
-    Super::BeginPlay();
-
-    // 체력 초기화
-    CurrentHealth = MaxHealth;
-}
-
 void AScarecrowEnemy::StartChasing()
 {
     // 허수아비는 추적하지 않음
@@ -26,8 +22,19 @@ void AScarecrowEnemy::Attack()
     // 허수아비는 공격하지 않음
 }
 
+void AScarecrowEnemy::ResetForReuse()
+{
+    Super::ResetForReuse();
+
+    bCanAttack = false;
+}
+
 void AScarecrowEnemy::ResetHealth()
 {
     CurrentHealth = MaxHealth;
+
+    // 푸시 모델 + 휴면 상태에서도 클라이언트가 회복된 체력을 받도록
+    MARK_PROPERTY_DIRTY_FROM_NAME(ABaseEnemy, CurrentHealth, this);
+    FlushReplicatedState();
     UpdateHealthBar();
 } 
\ No newline at end of file
@@ -12,14 +12,14 @@ class LOGIC_API AScarecrowEnemy : public ABaseEnemy
 public:
     AScarecrowEnemy();
 
-protected:
-    virtual void BeginPlay() override;
-
 public:
     // Override functions to disable AI behavior
     virtual void StartChasing() override;
     virtual void Attack() override;
 
+    // 풀에서 재사용될 때도 공격 비활성 유지
+    virtual void ResetForReuse() override;
+
     // Function to reset health for repeated testing
     UFUNCTION(BlueprintCallable, Category = "Testing")
     void ResetHealth();